@@ -1,5 +1,6 @@
 #include "config.h"
 #include "debug.h"
+#include "image.h"
 
 module_conf_t config[9];
 uint8_t ssdv1_buffer[1024*20];
@@ -8,6 +9,10 @@ uint8_t ssdv2_buffer[1024*130];
 // Put your configuration settings here
 void initModules(void)
 {
+	// Camera buffers, shared by all image modules
+	imgPoolAdd(ssdv1_buffer, sizeof(ssdv1_buffer));
+	imgPoolAdd(ssdv2_buffer, sizeof(ssdv2_buffer));
+
 	// Module POSITION, APRS 2m AFSK
 	chsnprintf(config[0].name, 17, "POS APRS 2m AFSK");		// Instance name
 	config[0].power = 20;									// Power 20 dBm
@@ -92,8 +97,6 @@ void initModules(void)
 	config[3].aprs_config.ssid = 11;						// APRS SSID
 	config[3].aprs_config.preamble = 200;					// APRS Preamble
 	chsnprintf(config[3].ssdv_config.callsign, 6, "DL7AD");// SSDV Callsign
-	config[3].ssdv_config.ram_buffer = ssdv1_buffer;		// Camera buffer
-	config[3].ssdv_config.ram_size = sizeof(ssdv1_buffer);	// Buffer size
 	config[3].ssdv_config.res = RES_QVGA;					// Resolution QVGA
 	MODULE_IMAGE(&config[3]);
 
@@ -127,8 +130,6 @@ void initModules(void)
 	config[5].aprs_config.ssid = 11;						// APRS SSID
 	config[5].aprs_config.preamble = 40;					// APRS Preamble
 	chsnprintf(config[5].ssdv_config.callsign, 6, "DL7AD");	// SSDV Callsign
-	config[5].ssdv_config.ram_buffer = ssdv2_buffer;		// Camera buffer
-	config[5].ssdv_config.ram_size = sizeof(ssdv2_buffer);	// Buffer size
 	config[5].ssdv_config.res = RES_XGA;					// Resolution XGA
 	MODULE_IMAGE(&config[5]);
 
@@ -148,8 +149,6 @@ void initModules(void)
 	config[6].fsk_config.baud = 600;						// Baudrate
 	config[6].fsk_config.shift = 1000;						// Frequency shift in Hz
 	chsnprintf(config[6].ssdv_config.callsign, 6, "DK0TU");// SSDV Callsign
-	config[6].ssdv_config.ram_buffer = ssdv2_buffer;		// Camera buffer
-	config[6].ssdv_config.ram_size = sizeof(ssdv2_buffer);	// Buffer size
 	config[6].ssdv_config.res = RES_VGA;					// Resolution VGA
 	MODULE_IMAGE(&config[6]);*/
 
@@ -27,112 +27,219 @@ bool BME280_isAvailable(uint8_t address)
 }
 
 /**
-  * Initializes BME280 and reads calibration data
+  * Reads pressure, temperature and humidity in one burst, so all values
+  * belong to the same measurement (DS 4)
   */
-void BME280_Init(bme280_t *handle, uint8_t address)
+static bool BME280_readBurst(uint8_t address, int32_t *adc_P, int32_t *adc_T, int32_t *adc_H)
 {
-	uint8_t tmp1;
-	uint8_t tmp2;
+	uint8_t buf[8];
+
+	if(!I2C_readN(address, BME280_REGISTER_PRESSUREDATA, buf, sizeof(buf)))
+		return false;
+
+	*adc_P = (buf[0] << 12) | (buf[1] << 4) | (buf[2] >> 4);
+	*adc_T = (buf[3] << 12) | (buf[4] << 4) | (buf[5] >> 4);
+	*adc_H = (buf[6] << 8) | buf[7];
+
+	return *adc_P != BME280_SKIPPED; // Not measuring (e.g. power cycled)
+}
+
+static int16_t BME280_compensateT(bme280_t *handle, int32_t adc_T)
+{
+	int32_t var1, var2;
+
+	var1 = ((((adc_T>>3) - ((int32_t)handle->calib.dig_T1 <<1))) * ((int32_t)handle->calib.dig_T2)) >> 11;
+	var2 = (((((adc_T>>4) - ((int32_t)handle->calib.dig_T1)) * ((adc_T>>4) - ((int32_t)handle->calib.dig_T1))) >> 12) * ((int32_t)handle->calib.dig_T3)) >> 14;
+
+	handle->t_fine = var1 + var2;
+
+	return (handle->t_fine * 5 + 128) >> 8;
+}
+
+/**
+  * Initializes BME280 and reads calibration data. The sensor is reset and
+  * left in normal mode, so it keeps measuring until it is reset again.
+  */
+bool BME280_Init(bme280_t *handle, uint8_t address)
+{
+	uint8_t c[26]; // 0x88..0xA1
+	uint8_t h[7];  // 0xE1..0xE7
+	int32_t adc_P, adc_T, adc_H;
 
 	handle->address = address;
+	handle->ready = false;
 
-	I2C_read16_LE(address, BME280_REGISTER_DIG_T1, &handle->calib.dig_T1);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_T2, &handle->calib.dig_T2);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_T3, &handle->calib.dig_T3);
+	// Reset, configuration is only accepted in sleep mode (DS 5.4.6)
+	if(!I2C_write8(address, BME280_REGISTER_SOFTRESET, 0xB6))
+		return false;
+	chThdSleepMilliseconds(BME280_RESET_TIME);
 
-	I2C_read16_LE(address, BME280_REGISTER_DIG_P1, &handle->calib.dig_P1);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P2, &handle->calib.dig_P2);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P3, &handle->calib.dig_P3);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P4, &handle->calib.dig_P4);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P5, &handle->calib.dig_P5);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P6, &handle->calib.dig_P6);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P7, &handle->calib.dig_P7);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P8, &handle->calib.dig_P8);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_P9, &handle->calib.dig_P9);
+	if(!I2C_readN(address, BME280_REGISTER_DIG_T1, c, sizeof(c))
+	|| !I2C_readN(address, BME280_REGISTER_DIG_H2, h, sizeof(h)))
+		return false;
 
-	I2C_read8(address, BME280_REGISTER_DIG_H1, &handle->calib.dig_H1);
-	I2C_readS16_LE(address, BME280_REGISTER_DIG_H2, &handle->calib.dig_H2);
-	I2C_read8(address, BME280_REGISTER_DIG_H3, &handle->calib.dig_H3);
+	handle->calib.dig_T1 = c[0] | (c[1] << 8);
+	handle->calib.dig_T2 = c[2] | (c[3] << 8);
+	handle->calib.dig_T3 = c[4] | (c[5] << 8);
 
-	I2C_read8(address, BME280_REGISTER_DIG_H4, &tmp1);
-	I2C_read8(address, BME280_REGISTER_DIG_H5, &tmp2);
-	handle->calib.dig_H4 = (((int8_t)tmp1) << 4) | (tmp2 & 0x0F);
+	handle->calib.dig_P1 = c[6] | (c[7] << 8);
+	handle->calib.dig_P2 = c[8] | (c[9] << 8);
+	handle->calib.dig_P3 = c[10] | (c[11] << 8);
+	handle->calib.dig_P4 = c[12] | (c[13] << 8);
+	handle->calib.dig_P5 = c[14] | (c[15] << 8);
+	handle->calib.dig_P6 = c[16] | (c[17] << 8);
+	handle->calib.dig_P7 = c[18] | (c[19] << 8);
+	handle->calib.dig_P8 = c[20] | (c[21] << 8);
+	handle->calib.dig_P9 = c[22] | (c[23] << 8);
 
-	I2C_read8(address, BME280_REGISTER_DIG_H6, &tmp1);
-	I2C_read8(address, BME280_REGISTER_DIG_H5, &tmp2);
-	handle->calib.dig_H5 = (((int8_t)tmp1) << 4) | (tmp2 >> 4 & 0x0F);
+	handle->calib.dig_H1 = c[25];
+	handle->calib.dig_H2 = h[0] | (h[1] << 8);
+	handle->calib.dig_H3 = h[2];
+	handle->calib.dig_H4 = (((int8_t)h[3]) << 4) | (h[4] & 0x0F);
+	handle->calib.dig_H5 = (((int8_t)h[5]) << 4) | (h[4] >> 4);
+	handle->calib.dig_H6 = (int8_t)h[6];
 
-	I2C_read8(address, BME280_REGISTER_DIG_H6, (uint8_t*)&handle->calib.dig_H6);
+	if(!I2C_write8(address, BME280_REGISTER_CONFIG, BME280_CONFIG)
+	|| !I2C_write8(address, BME280_REGISTER_CONTROLHUMID, BME280_CTRL_HUM) // Set before CONTROL (DS 5.4.3)
+	|| !I2C_write8(address, BME280_REGISTER_CONTROL, BME280_CTRL_MEAS))
+		return false;
+	chThdSleepMilliseconds(BME280_MEAS_TIME); // Wait for first measurement
 
-	I2C_write8(address, BME280_REGISTER_CONTROLHUMID, 0x03); // Set before CONTROL (DS 5.4.3)
-	I2C_write8(address, BME280_REGISTER_CONTROL, 0x3F);
-	chThdSleepMilliseconds(50); // Wait for BME280
+	// Set t_fine, a failure is left to the caller (BME280_Ready marks the sensor lost)
+	if(!BME280_readBurst(address, &adc_P, &adc_T, &adc_H))
+		return false;
+	BME280_compensateT(handle, adc_T);
 
-	BME280_getTemperature(handle); // Set t_fine
+	handle->ready = true;
+	return true;
 }
 
 /**
-  * Reads the temperature
-  * @return Temperature in degC * 100
+  * Prepares a handle, the sensor is detected by BME280_Ready
   */
-int16_t BME280_getTemperature(bme280_t *handle)
+void BME280_Open(bme280_t *handle, uint8_t address)
 {
-	int32_t var1, var2, adc_T;
-	uint16_t tmp;
+	handle->address = address;
+	handle->ready = false;
+	handle->backoff = 0;
+}
 
-	I2C_read16(handle->address, BME280_REGISTER_TEMPDATA, &tmp);
-	adc_T = tmp;
-	I2C_read8(handle->address, BME280_REGISTER_TEMPDATA+2, (uint8_t*)&tmp);
-	adc_T <<= 8;
-	adc_T |= tmp & 0xFF;
-	adc_T >>= 4;
+/**
+  * Marks the sensor as lost. Detection is retried after a backoff which
+  * doubles with every failed attempt.
+  */
+static void BME280_Lost(bme280_t *handle)
+{
+	handle->ready = false;
+	handle->lost = chVTGetSystemTimeX();
+	if(!handle->backoff)
+		handle->backoff = BME280_RETRY_MIN;
+	else if(handle->backoff < BME280_RETRY_MAX)
+		handle->backoff = handle->backoff*2 < BME280_RETRY_MAX ? handle->backoff*2 : BME280_RETRY_MAX;
+}
 
-	var1 = ((((adc_T>>3) - ((int32_t)handle->calib.dig_T1 <<1))) * ((int32_t)handle->calib.dig_T2)) >> 11;
-	var2 = (((((adc_T>>4) - ((int32_t)handle->calib.dig_T1)) * ((adc_T>>4) - ((int32_t)handle->calib.dig_T1))) >> 12) * ((int32_t)handle->calib.dig_T3)) >> 14;
+/**
+  * Returns true if the sensor is initialized. An absent sensor is detected
+  * and initialized again once its backoff has expired. No I2C traffic
+  * while the sensor is ready.
+  */
+bool BME280_Ready(bme280_t *handle)
+{
+	if(handle->ready)
+		return true;
 
-	handle->t_fine = var1 + var2;
+	if(handle->backoff && chVTTimeElapsedSinceX(handle->lost) < S2ST(handle->backoff))
+		return false;
 
-	return (handle->t_fine * 5 + 128) >> 8;
+	if(BME280_isAvailable(handle->address) && BME280_Init(handle, handle->address)) {
+		handle->backoff = 0;
+		return true;
+	}
+
+	BME280_Lost(handle);
+	return false;
+}
+
+/**
+  * Reads the measurement and marks the sensor as lost if it failed
+  */
+static bool BME280_readRaw(bme280_t *handle, int32_t *adc_P, int32_t *adc_T, int32_t *adc_H)
+{
+	if(!handle->ready)
+		return false;
+
+	if(!BME280_readBurst(handle->address, adc_P, adc_T, adc_H)) {
+		BME280_Lost(handle);
+		return false;
+	}
+	return true;
 }
 
 /**
-  * Reads the barometric pressure
-  * @param Values to be sampled
+  * Returns the pressure in Pa as Q24.8, 0 if calibration is invalid
+  */
+static uint32_t BME280_compensateP(bme280_t *handle, int32_t adc_P)
+{
+	int64_t var1, var2, p;
+
+	var1 = ((int64_t)handle->t_fine) - 128000;
+	var2 = var1 * var1 * (int64_t)handle->calib.dig_P6;
+	var2 = var2 + ((var1*(int64_t)handle->calib.dig_P5)<<17);
+	var2 = var2 + (((int64_t)handle->calib.dig_P4)<<35);
+	var1 = ((var1 * var1 * (int64_t)handle->calib.dig_P3)>>8) + ((var1 * (int64_t)handle->calib.dig_P2)<<12);
+	var1 = (((((int64_t)1)<<47)+var1))*((int64_t)handle->calib.dig_P1)>>33;
+
+	if (var1 == 0)
+		return 0;  // avoid exception caused by division by zero
+
+	p = 1048576 - adc_P;
+	p = (((p<<31) - var2)*3125) / var1;
+	var1 = (((int64_t)handle->calib.dig_P9) * (p>>13) * (p>>13)) >> 25;
+	var2 = (((int64_t)handle->calib.dig_P8) * p) >> 19;
+
+	return ((p + var1 + var2) >> 8) + (((int64_t)handle->calib.dig_P7)<<4);
+}
+
+/**
+  * Reads the temperature
+  * @return Temperature in degC * 100
+  */
+int16_t BME280_getTemperature(bme280_t *handle)
+{
+	int32_t adc_P, adc_T, adc_H;
+
+	if(!BME280_readRaw(handle, &adc_P, &adc_T, &adc_H))
+		return 0;
+	return BME280_compensateT(handle, adc_T);
+}
+
+/**
+  * Reads the barometric pressure. The sensor oversamples and filters
+  * itself, the raw values of consecutive measurements are averaged and
+  * compensated once.
+  * @param Measurements to be averaged
   * @return Pressure in Pa * 10
   */
 uint32_t BME280_getPressure(bme280_t *handle, uint16_t means) {
-	int64_t var1, var2, p;
-	uint16_t tmp;
+	int32_t adc_P, adc_T, adc_H;
+	int64_t sum_P = 0;
+	int64_t sum_T = 0;
+	uint16_t n = 0;
 
-	uint64_t sum = 0;
 	for(uint16_t i=0; i<means; i++) {
-		int32_t adc_P;
-		I2C_read16(handle->address, BME280_REGISTER_PRESSUREDATA, &tmp);
-		adc_P = tmp;
-		I2C_read8(handle->address, BME280_REGISTER_PRESSUREDATA+2, (uint8_t*)&tmp);
-		adc_P <<= 8;
-		adc_P |= tmp & 0xFF;
-		adc_P >>= 4;
-
-		var1 = ((int64_t)handle->t_fine) - 128000;
-		var2 = var1 * var1 * (int64_t)handle->calib.dig_P6;
-		var2 = var2 + ((var1*(int64_t)handle->calib.dig_P5)<<17);
-		var2 = var2 + (((int64_t)handle->calib.dig_P4)<<35);
-		var1 = ((var1 * var1 * (int64_t)handle->calib.dig_P3)>>8) + ((var1 * (int64_t)handle->calib.dig_P2)<<12);
-		var1 = (((((int64_t)1)<<47)+var1))*((int64_t)handle->calib.dig_P1)>>33;
-
-		if (var1 == 0)
-			return 0;  // avoid exception caused by division by zero
-
-		p = 1048576 - adc_P;
-		p = (((p<<31) - var2)*3125) / var1;
-		var1 = (((int64_t)handle->calib.dig_P9) * (p>>13) * (p>>13)) >> 25;
-		var2 = (((int64_t)handle->calib.dig_P8) * p) >> 19;
-
-		sum += ((p + var1 + var2) >> 8) + (((int64_t)handle->calib.dig_P7)<<4);
+		if(i)
+			chThdSleepMilliseconds(BME280_MEAS_TIME); // Wait for next measurement
+		if(!BME280_readRaw(handle, &adc_P, &adc_T, &adc_H))
+			continue;
+		sum_P += adc_P;
+		sum_T += adc_T;
+		n++;
 	}
+	if(!n)
+		return 0;
 
-	return sum/(means*26);
+	BME280_compensateT(handle, (sum_T + n/2) / n); // Set t_fine
+	return BME280_compensateP(handle, (sum_P + n/2) / n) / 26;
 }
 
 /**
@@ -140,10 +247,9 @@ uint32_t BME280_getPressure(bme280_t *handle, uint16_t means) {
   * @return rel. humidity in % * 10
   */
 uint16_t BME280_getHumidity(bme280_t *handle) {
-	int32_t adc_H;
-	uint16_t tmp;
-	I2C_read16(handle->address, BME280_REGISTER_HUMIDDATA, &tmp);
-	adc_H = tmp;
+	int32_t adc_P, adc_T, adc_H;
+	if(!BME280_readRaw(handle, &adc_P, &adc_T, &adc_H))
+		return 0;
 
 	int32_t v_x1_u32r;
 
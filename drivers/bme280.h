@@ -56,6 +56,16 @@
 #define BME280_REGISTER_TEMPDATA		0xFA
 #define BME280_REGISTER_HUMIDDATA		0xFD
 
+#define BME280_CTRL_HUM					0x01	/* Humidity oversampling x1 */
+#define BME280_CTRL_MEAS				0x57	/* Temperature x2, pressure x16, normal mode */
+#define BME280_CONFIG					0x08	/* Standby 0.5ms, IIR filter coefficient 4 */
+#define BME280_MEAS_TIME				47		/* Measurement period in ms with the settings above (DS 9.1) */
+#define BME280_MEANS					4		/* Measurements averaged by BME280_getPressure */
+#define BME280_RESET_TIME				2		/* Start-up time in ms after soft reset (DS 1) */
+#define BME280_SKIPPED					0x80000	/* Raw pressure while not measuring */
+#define BME280_RETRY_MIN				10		/* First retry in s after the sensor got lost */
+#define BME280_RETRY_MAX				600		/* Max. retry interval in s */
+
 typedef struct {
 	uint16_t dig_T1;
 	int16_t  dig_T2;
@@ -84,10 +94,15 @@ typedef struct {
 	uint8_t address;
 	int32_t t_fine;
 	bme280_calib_data_t calib;
+	bool ready;				// Calibration read and sensor measuring
+	systime_t lost;			// Time the sensor got lost
+	uint16_t backoff;		// Retry interval in s (0 = retry immediately)
 } bme280_t;
 
 bool BME280_isAvailable(uint8_t address);
-void BME280_Init(bme280_t *handle, uint8_t address);
+bool BME280_Init(bme280_t *handle, uint8_t address);
+void BME280_Open(bme280_t *handle, uint8_t address);
+bool BME280_Ready(bme280_t *handle);
 int16_t BME280_getTemperature(bme280_t *handle);
 uint32_t BME280_getPressure(bme280_t *handle, uint16_t means);
 uint16_t BME280_getHumidity(bme280_t *handle);
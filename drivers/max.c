@@ -9,37 +9,269 @@
 #include "debug.h"
 #include "config.h"
 #include "defines.h"
+#include <string.h>
 
 #if GPS_TYPE != MAX6 && GPS_TYPE != MAX7 && GPS_TYPE != MAX8
 #error No valid GPS type set (Choose MAX6, MAX7 or MAX8 in board.h)
 #endif
 
+#define GPS_DDC_AVAIL		0xFD	/* DDC register: bytes available (2 bytes) */
+#define GPS_DDC_STREAM		0xFF	/* DDC register: message stream */
+#define GPS_DDC_CHUNK		64		/* Max. bytes read in one I2C transaction */
+#define GPS_POLL_INTERVAL	20		/* Time in ms between polls of the DDC buffer */
+#define GPS_UBX_MAX_PAYLOAD	100		/* Longest payload kept by the framer */
+#define GPS_PVT_RATE		1		/* NAV-PVT output every n navigation solutions */
+#define GPS_PVT_TIMEOUT		2500	/* Time in ms to wait for the next periodic NAV-PVT */
+#define GPS_PVT_MIN_LEN		84		/* NAV-PVT length of u-blox 7 (u-blox 8: 92), all decoded fields below 40 */
+
+/*
+ * UBX receiver. The GPS collects its output in its own DDC buffer, so no
+ * byte is lost while the MCU sleeps. The buffer is read in bursts and fed
+ * into an incremental framer which checks the Fletcher checksum. Every
+ * valid message is dispatched to the message table below, so replies are
+ * kept even if they arrive while another message is awaited.
+ */
+typedef struct {
+	enum {UBX_SYNC1, UBX_SYNC2, UBX_CLASS, UBX_ID, UBX_LEN1, UBX_LEN2, UBX_PAYLOAD, UBX_CK_A, UBX_CK_B} state;
+	uint8_t cls;
+	uint8_t id;
+	uint16_t len;
+	uint16_t cnt;
+	uint8_t ck_a;
+	uint8_t ck_b;
+	uint8_t payload[GPS_UBX_MAX_PAYLOAD];
+} ubx_framer_t;
+
+typedef struct {
+	uint8_t cls;
+	uint8_t id;
+	uint8_t *payload;	// Latest payload
+	uint16_t size;		// Size of payload buffer
+	uint16_t len;		// Length of latest payload
+	uint16_t seq;		// Incremented with every message received
+} ubx_msg_t;
+
+static uint8_t ack_payload[2];
+static uint8_t nak_payload[2];
+static uint8_t nav_payload[4][GPS_UBX_MAX_PAYLOAD];
+
+static ubx_msg_t ubx_msgs[] = {
+	{0x05, 0x01, ack_payload,    sizeof(ack_payload),    0, 0},	// ACK-ACK
+	{0x05, 0x00, nak_payload,    sizeof(nak_payload),    0, 0},	// ACK-NAK
+	{0x01, 0x07, nav_payload[0], sizeof(nav_payload[0]), 0, 0},	// NAV-PVT
+	{0x01, 0x02, nav_payload[1], sizeof(nav_payload[1]), 0, 0},	// NAV-POSLLH
+	{0x01, 0x06, nav_payload[2], sizeof(nav_payload[2]), 0, 0},	// NAV-SOL
+	{0x01, 0x21, nav_payload[3], sizeof(nav_payload[3]), 0, 0},	// NAV-TIMEUTC
+};
+
+static ubx_framer_t ubx_framer;
+static uint32_t ubx_checksum_errors;
+static uint32_t ubx_unhandled;
+
+static ubx_msg_t* ubx_find(uint8_t cls, uint8_t id)
+{
+	for(uint32_t i=0; i<sizeof(ubx_msgs)/sizeof(ubx_msg_t); i++)
+		if(ubx_msgs[i].cls == cls && ubx_msgs[i].id == id)
+			return &ubx_msgs[i];
+	return NULL;
+}
+
+/*
+ * Latest NAV-PVT solution. The receiver outputs NAV-PVT periodically, every
+ * message is decoded into this slot. gps_fix_seq is odd while the slot is
+ * written, readers retry if it changed during their copy.
+ */
+static gpsFix_t gps_fix;
+static volatile uint32_t gps_fix_seq;
+
+static void gps_decode_pvt(const uint8_t *response, gpsFix_t *fix)
+{
+	fix->num_svs = response[23];
+	fix->type = response[20];
+
+	fix->time.year = response[4] + (response[5] << 8);
+	fix->time.month = response[6];
+	fix->time.day = response[7];
+	fix->time.hour = response[8];
+	fix->time.minute = response[9];
+	fix->time.second = response[10];
+
+	fix->lat = (int32_t) (
+			(uint32_t)(response[28]) + ((uint32_t)(response[29]) << 8) + ((uint32_t)(response[30]) << 16) + ((uint32_t)(response[31]) << 24)
+			);
+	fix->lon = (int32_t) (
+			(uint32_t)(response[24]) + ((uint32_t)(response[25]) << 8) + ((uint32_t)(response[26]) << 16) + ((uint32_t)(response[27]) << 24)
+			);
+	int32_t alt_tmp = (((int32_t) 
+			((uint32_t)(response[36]) + ((uint32_t)(response[37]) << 8) + ((uint32_t)(response[38]) << 16) + ((uint32_t)(response[39]) << 24))
+			) / 1000);
+	if (alt_tmp <= 0) {
+		fix->alt = 1;
+	} else if (alt_tmp > 50000) {
+		fix->alt = 50000;
+	} else {
+		fix->alt = (uint16_t)alt_tmp;
+	}
+}
+
+static void gps_publish_pvt(const uint8_t *payload)
+{
+	gps_fix_seq++;
+	__DMB();
+	gps_decode_pvt(payload, &gps_fix);
+	__DMB();
+	gps_fix_seq++;
+}
+
+/**
+  * Copies the latest NAV-PVT solution. Returns the sequence number of the
+  * solution (0 = none received yet).
+  */
+uint32_t gps_latest_fix(gpsFix_t *fix)
+{
+	uint32_t seq;
+
+	do {
+		while((seq = gps_fix_seq) & 1)
+			chThdSleepMilliseconds(1);
+		__DMB();
+		*fix = gps_fix;
+		__DMB();
+	} while(seq != gps_fix_seq);
+
+	return seq / 2;
+}
+
+static void ubx_dispatch(ubx_framer_t *f)
+{
+	ubx_msg_t *msg = ubx_find(f->cls, f->id);
+
+	if(!msg || f->len > msg->size) {
+		ubx_unhandled++;
+		return;
+	}
+
+	memcpy(msg->payload, f->payload, f->len);
+	msg->len = f->len;
+	msg->seq++;
+
+	if(f->cls == 0x01 && f->id == 0x07 && f->len >= GPS_PVT_MIN_LEN) // NAV-PVT
+		gps_publish_pvt(f->payload);
+}
+
+/**
+  * Feeds one byte into the framer. Frames with a wrong checksum are dropped,
+  * payloads longer than the framer buffer are checked but not dispatched.
+  */
+static void ubx_feed(ubx_framer_t *f, uint8_t b)
+{
+	if(f->state >= UBX_CLASS && f->state <= UBX_PAYLOAD) { // Fletcher checksum
+		f->ck_a += b;
+		f->ck_b += f->ck_a;
+	}
+
+	switch(f->state) {
+		case UBX_SYNC1:
+			if(b == 0xB5)
+				f->state = UBX_SYNC2;
+			break;
+		case UBX_SYNC2:
+			f->state = b == 0x62 ? UBX_CLASS : b == 0xB5 ? UBX_SYNC2 : UBX_SYNC1;
+			f->ck_a = 0;
+			f->ck_b = 0;
+			break;
+		case UBX_CLASS:
+			f->cls = b;
+			f->state = UBX_ID;
+			break;
+		case UBX_ID:
+			f->id = b;
+			f->state = UBX_LEN1;
+			break;
+		case UBX_LEN1:
+			f->len = b;
+			f->state = UBX_LEN2;
+			break;
+		case UBX_LEN2:
+			f->len |= b << 8;
+			f->cnt = 0;
+			f->state = f->len ? UBX_PAYLOAD : UBX_CK_A;
+			break;
+		case UBX_PAYLOAD:
+			if(f->cnt < GPS_UBX_MAX_PAYLOAD)
+				f->payload[f->cnt] = b;
+			if(++f->cnt == f->len)
+				f->state = UBX_CK_A;
+			break;
+		case UBX_CK_A:
+			f->state = b == f->ck_a ? UBX_CK_B : UBX_SYNC1;
+			if(f->state == UBX_SYNC1)
+				ubx_checksum_errors++;
+			break;
+		case UBX_CK_B:
+			if(b != f->ck_b)
+				ubx_checksum_errors++;
+			else if(f->len <= GPS_UBX_MAX_PAYLOAD)
+				ubx_dispatch(f);
+			else
+				ubx_unhandled++;
+			f->state = UBX_SYNC1;
+			break;
+	}
+}
+
+/**
+  * Reads everything the GPS has buffered and feeds it into the framer.
+  * Returns false if nothing was available.
+  */
+static bool gps_poll(void)
+{
+	uint8_t buf[GPS_DDC_CHUNK];
+	uint16_t avail;
+
+	if(!I2C_read16(UBLOX_MAX_ADDRESS, GPS_DDC_AVAIL, &avail) || !avail || avail == 0xFFFF)
+		return false;
+
+	while(avail) {
+		uint16_t n = avail < sizeof(buf) ? avail : sizeof(buf);
+		if(!I2C_readN(UBLOX_MAX_ADDRESS, GPS_DDC_STREAM, buf, n))
+			return false;
+		for(uint16_t i=0; i<n; i++)
+			ubx_feed(&ubx_framer, buf[i]);
+		avail -= n;
+	}
+
+	return true;
+}
+
 /* 
  * gps_transmit_string
  *
- * transmits a command to the GPS
+ * transmits a command to the GPS. Pending output is dispatched before, so
+ * every reply received afterwards belongs to this command.
  */
 void gps_transmit_string(uint8_t *cmd, uint8_t length)
 {
+	gps_poll();
 	I2C_writeN(UBLOX_MAX_ADDRESS, cmd, length);
 }
 
-uint8_t gps_receive_byte(void)
+/*
+ * gps_checksum
+ *
+ * fills in the checksum (last two bytes) of a UBX command
+ */
+static void gps_checksum(uint8_t *cmd, uint8_t length)
 {
-	uint8_t val;
-	if(I2C_read8(UBLOX_MAX_ADDRESS, 0xFF, &val))
-		return val;
-	else
-		return 0x00;
-}
+	uint8_t ck_a = 0;
+	uint8_t ck_b = 0;
 
-uint16_t gps_bytes_avail(void)
-{
-	uint16_t val;
-	if(I2C_read16(UBLOX_MAX_ADDRESS, 0xFD, &val))
-		return val;
-	else
-		return 0x00;
+	for(uint8_t i=2; i<length-2; i++) {
+		ck_a += cmd[i];
+		ck_b += ck_a;
+	}
+	cmd[length-2] = ck_a;
+	cmd[length-1] = ck_b;
 }
 
 /* 
@@ -51,44 +283,22 @@ uint16_t gps_bytes_avail(void)
  *
  */
 uint8_t gps_receive_ack(uint8_t class_id, uint8_t msg_id, uint16_t timeout) {
-	int match_count = 0;
-	int msg_ack = 0;
-	uint8_t rx_byte;
-	uint8_t ack[] = {0xB5, 0x62, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00};
-	uint8_t nak[] = {0xB5, 0x62, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00};
-	ack[6] = class_id;
-	nak[6] = class_id;
-	ack[7] = msg_id;
-	nak[7] = msg_id;
-
-	// runs until ACK/NAK packet is received
+	ubx_msg_t *ack = ubx_find(0x05, 0x01);
+	ubx_msg_t *nak = ubx_find(0x05, 0x00);
+	uint16_t ack_seq = ack->seq;
+	uint16_t nak_seq = nak->seq;
+
 	systime_t sTimeout = chVTGetSystemTimeX() + MS2ST(timeout);
 	while(chVTGetSystemTimeX() <= sTimeout) {
-
-		// Receive one byte
-		if(!gps_bytes_avail()) { // No byte available
-			chThdSleepMilliseconds(100);
-			continue;
-		}
-		rx_byte = gps_receive_byte();
-
-		// Process one byte
-		if (rx_byte == ack[match_count] || rx_byte == nak[match_count]) {
-			if (match_count == 3) {	/* test ACK/NAK byte */
-				if (rx_byte == ack[match_count]) {
-					msg_ack = 1;
-				} else {
-					msg_ack = 0;
-				}
-			}
-			if (match_count == 7) { 
-				return msg_ack;
-			}
-			match_count++;
-		} else {
-			match_count = 0;
-		}
-
+		if(!gps_poll())
+			chThdSleepMilliseconds(GPS_POLL_INTERVAL);
+
+		if(ack->seq != ack_seq && ack_payload[0] == class_id && ack_payload[1] == msg_id)
+			return 1;
+		if(nak->seq != nak_seq && nak_payload[0] == class_id && nak_payload[1] == msg_id)
+			return 0;
+		ack_seq = ack->seq; // Acknowledge of another message
+		nak_seq = nak->seq;
 	}
 
 	return false;
@@ -104,63 +314,23 @@ uint8_t gps_receive_ack(uint8_t class_id, uint8_t msg_id, uint16_t timeout) {
  *
  */
 uint16_t gps_receive_payload(uint8_t class_id, uint8_t msg_id, unsigned char *payload, uint16_t timeout) {
-	uint8_t rx_byte;
-	enum {UBX_A, UBX_B, CLASSID, MSGID, LEN_A, LEN_B, PAYLOAD} state = UBX_A;
-	uint16_t payload_cnt = 0;
-	uint16_t payload_len = 0;
-	uint16_t bytes_avail = 0;
+	ubx_msg_t *msg = ubx_find(class_id, msg_id);
+	if(!msg)
+		return 0;
+	uint16_t seq = msg->seq;
 
 	systime_t sTimeout = chVTGetSystemTimeX() + MS2ST(timeout);
 	while(chVTGetSystemTimeX() <= sTimeout) {
+		if(!gps_poll())
+			chThdSleepMilliseconds(GPS_POLL_INTERVAL);
 
-		// Receive one byte
-		if(!bytes_avail)
-			bytes_avail = gps_bytes_avail();
-		if(!bytes_avail) {
-			chThdSleepMilliseconds(50);
-			continue;
-		}
-		
-		rx_byte = gps_receive_byte();
-		bytes_avail--;
-
-		// Process one byte
-		switch (state) {
-			case UBX_A:
-				if (rx_byte == 0xB5)	state = UBX_B;
-				else 			state = UBX_A;
-				break;
-			case UBX_B:
-				if (rx_byte == 0x62)	state = CLASSID;
-				else			state = UBX_A;
-				break;
-			case CLASSID:
-				if (rx_byte == class_id)state = MSGID;
-				else			state = UBX_A;
-				break;
-			case MSGID:
-				if (rx_byte == msg_id)	state = LEN_A;
-				else			state = UBX_A;
-				break;
-			case LEN_A:
-				payload_len = rx_byte;
-				state = LEN_B;
-				break;
-			case LEN_B:
-				payload_len |= ((uint16_t)rx_byte << 8);
-				state = PAYLOAD;
-				break;
-			case PAYLOAD:
-				payload[payload_cnt] = rx_byte;
-				payload_cnt++;
-				if (payload_cnt == payload_len)
-					return payload_len;
-				break;
-			default:
-				state = UBX_A;
+		if(msg->seq != seq) {
+			memcpy(payload, msg->payload, msg->len);
+			return msg->len;
 		}
 	}
 
+	TRACE_WARN("GPS  > No message %02x-%02x (checksum errors %d, unhandled %d)", class_id, msg_id, ubx_checksum_errors, ubx_unhandled);
 	return 0;
 }
 
@@ -179,47 +349,36 @@ uint16_t gps_receive_payload(uint8_t class_id, uint8_t msg_id, unsigned char *pa
  *
  */
 bool gps_get_fix(gpsFix_t *fix) {
-	static uint8_t response[92];
+	static uint8_t response[GPS_UBX_MAX_PAYLOAD];
 
 	#if GPS_TYPE == MAX7 || GPS_TYPE == MAX8
 
-	// Transmit request
+	// Wait for the next periodic solution
+	static uint32_t last_seq;
+	systime_t sTimeout = chVTGetSystemTimeX() + MS2ST(GPS_PVT_TIMEOUT);
+	while(chVTGetSystemTimeX() <= sTimeout) {
+		if(!gps_poll())
+			chThdSleepMilliseconds(GPS_POLL_INTERVAL);
+
+		uint32_t seq = gps_latest_fix(fix);
+		if(seq != last_seq) {
+			last_seq = seq;
+			return true;
+		}
+	}
+
+	// No periodic output (not configured), poll it
 	uint8_t pvt[] = {0xB5, 0x62, 0x01, 0x07, 0x00, 0x00, 0x08, 0x19};
 	gps_transmit_string(pvt, sizeof(pvt));
 
-	if(!gps_receive_payload(0x01, 0x07, response, 5000)) { // Receive request
+	if(gps_receive_payload(0x01, 0x07, response, 5000) < GPS_PVT_MIN_LEN) { // Receive request
 		TRACE_INFO("GPS  > PVT Polling FAILED");
 		return false;
 	}
 
 	TRACE_INFO("GPS  > PVT Polling OK");
-
-	fix->num_svs = response[23];
-	fix->type = response[20];
-
-	fix->time.year = response[4] + (response[5] << 8);
-	fix->time.month = response[6];
-	fix->time.day = response[7];
-	fix->time.hour = response[8];
-	fix->time.minute = response[9];
-	fix->time.second = response[10];
-
-	fix->lat = (int32_t) (
-			(uint32_t)(response[28]) + ((uint32_t)(response[29]) << 8) + ((uint32_t)(response[30]) << 16) + ((uint32_t)(response[31]) << 24)
-			);
-	fix->lon = (int32_t) (
-			(uint32_t)(response[24]) + ((uint32_t)(response[25]) << 8) + ((uint32_t)(response[26]) << 16) + ((uint32_t)(response[27]) << 24)
-			);
-	int32_t alt_tmp = (((int32_t) 
-			((uint32_t)(response[36]) + ((uint32_t)(response[37]) << 8) + ((uint32_t)(response[38]) << 16) + ((uint32_t)(response[39]) << 24))
-			) / 1000);
-	if (alt_tmp <= 0) {
-		fix->alt = 1;
-	} else if (alt_tmp > 50000) {
-		fix->alt = 50000;
-	} else {
-		fix->alt = (uint16_t)alt_tmp;
-	}
+	gps_decode_pvt(response, fix);
+	last_seq = gps_fix_seq / 2; // Polled solution is published too, don't report it twice
 
 	return true;
 
@@ -346,6 +505,27 @@ uint8_t gps_set_gps_only(void) {
 	return gps_receive_ack(0x06, 0x3E, 1000);
 }
 
+/*
+ * gps_set_periodic_pvt
+ *
+ * tells the GPS to output NAV-PVT periodically on the current port (DDC)
+ *
+ * returns if ACKed by GPS
+ *
+ */
+uint8_t gps_set_periodic_pvt(void) {
+	uint8_t msg[] = {
+		0xB5, 0x62, 0x06, 0x01, 3, 0x00,	// UBX-CFG-MSG
+		0x01, 0x07,							// NAV-PVT
+		GPS_PVT_RATE,						// rate on current port
+		0x00, 0x00							// checksum
+	};
+
+	gps_checksum(msg, sizeof(msg));
+	gps_transmit_string(msg, sizeof(msg));
+	return gps_receive_ack(0x06, 0x01, 1000);
+}
+
 /*
  * gps_set_airborne_model
  *
@@ -455,21 +635,31 @@ uint8_t gps_power_save(int on) {
 	return gps_receive_ack(0x06, 0x09, 1000);
 }*/
 
-bool GPS_Init(void) {
-	// Initialize pins
-	TRACE_INFO("GPS  > Init pins");
-	palSetPadMode(PORT(GPS_RESET), PIN(GPS_RESET), PAL_MODE_OUTPUT_PUSHPULL);	// GPS reset
-	palSetPadMode(PORT(GPS_EN), PIN(GPS_EN), PAL_MODE_OUTPUT_PUSHPULL);			// GPS off
-	palSetPadMode(PORT(GPS_TIMEPULSE), PIN(GPS_TIMEPULSE), PAL_MODE_INPUT);		// GPS timepulse
+/*
+ * gps_backup
+ *
+ * puts the GPS into software backup mode for duration ms (UBX-RXM-PMREQ).
+ * Ephemeris, almanac and RTC are retained, the receiver wakes up by itself
+ * after the duration and does a hot start. The request is not ACKed.
+ */
+static void gps_backup(uint32_t duration) {
+	uint8_t pmreq[] = {
+		0xB5, 0x62, 0x02, 0x41, 8, 0,		// UBX-RXM-PMREQ
+		0x00, 0x00, 0x00, 0x00,				// duration, ms
+		0x02, 0x00, 0x00, 0x00,				// flags: backup
+		0x00, 0x00							// checksum
+	};
 
-	// Switch MOSFET
-	TRACE_INFO("GPS  > Switch on");
-	palSetPad(PORT(GPS_RESET), PIN(GPS_RESET));	// Pull up GPS reset
-	palSetPad(PORT(GPS_EN), PIN(GPS_EN));		// Switch on GPS
-	
-	// Wait for GPS startup
-	chThdSleepMilliseconds(3000);
+	pmreq[6] = duration;
+	pmreq[7] = duration >> 8;
+	pmreq[8] = duration >> 16;
+	pmreq[9] = duration >> 24;
 
+	gps_checksum(pmreq, sizeof(pmreq));
+	gps_transmit_string(pmreq, sizeof(pmreq));
+}
+
+static bool gps_configure(void) {
 	uint8_t status = 1;
 
 	// Configure GPS
@@ -491,6 +681,16 @@ bool GPS_Init(void) {
 	}
 	#endif
 
+	#if GPS_TYPE == MAX7 || GPS_TYPE == MAX8
+	// MAX6 has no NAV-PVT, it is polled by POSLLH, SOL and TIMEUTC
+	if(gps_set_periodic_pvt()) {
+		TRACE_INFO("GPS  > Set periodic NAV-PVT OK");
+	} else {
+		TRACE_ERROR("GPS  > Set periodic NAV-PVT FAILED");
+		status = 0;
+	}
+	#endif
+
 	if(gps_set_airborne_model()) {
 		TRACE_INFO("GPS  > Set airborne model OK");
 	} else {
@@ -513,6 +713,24 @@ bool GPS_Init(void) {
 	return status;
 }
 
+bool GPS_Init(void) {
+	// Initialize pins
+	TRACE_INFO("GPS  > Init pins");
+	palSetPadMode(PORT(GPS_RESET), PIN(GPS_RESET), PAL_MODE_OUTPUT_PUSHPULL);	// GPS reset
+	palSetPadMode(PORT(GPS_EN), PIN(GPS_EN), PAL_MODE_OUTPUT_PUSHPULL);			// GPS off
+	palSetPadMode(PORT(GPS_TIMEPULSE), PIN(GPS_TIMEPULSE), PAL_MODE_INPUT);		// GPS timepulse
+
+	// Switch MOSFET
+	TRACE_INFO("GPS  > Switch on");
+	palSetPad(PORT(GPS_RESET), PIN(GPS_RESET));	// Pull up GPS reset
+	palSetPad(PORT(GPS_EN), PIN(GPS_EN));		// Switch on GPS
+	
+	// Wait for GPS startup
+	chThdSleepMilliseconds(3000);
+
+	return gps_configure();
+}
+
 void GPS_Deinit(void)
 {
 	// Switch MOSFET
@@ -520,6 +738,175 @@ void GPS_Deinit(void)
 	palClearPad(PORT(GPS_EN), PIN(GPS_EN));
 }
 
+/*
+ * GPS power manager
+ *
+ * Between two tracking cycles the GPS is put into one of three modes:
+ * switched off (cold/warm start), software backup (hot start, ephemeris
+ * retained) or cyclic tracking (stays locked at reduced power). The mode
+ * with the least expected energy until the next lock is chosen from the
+ * sleep time and the TTFF measured for each mode.
+ */
+static const char *gps_pm_names[GPS_PM_MODES] = {"OFF", "BACKUP", "CYCLIC"};
+static const uint32_t gps_pm_power[GPS_PM_MODES] = {0, GPS_PM_BACKUP_POWER, GPS_PM_CYCLIC_POWER};
+static gps_pm_stats_t gps_pm_stats[GPS_PM_MODES] = {
+	{.ttff_avg = GPS_PM_TTFF_OFF},
+	{.ttff_avg = GPS_PM_TTFF_BACKUP},
+	{.ttff_avg = GPS_PM_TTFF_CYCLIC}
+};
+static gps_pm_mode_t gps_pm_mode = GPS_PM_OFF;	// Mode the GPS sleeps in or has been woken from
+static bool gps_pm_awake;
+static systime_t gps_pm_since;					// Start of sleep or acquisition
+static systime_t gps_pm_wake_at;				// Wakeup time scheduled in backup mode
+
+static void gps_pm_account(gps_pm_mode_t mode, uint32_t power, systime_t since)
+{
+	uint32_t ms = ST2MS(chVTTimeElapsedSinceX(since));
+	gps_pm_stats[mode].energy += (uint64_t)power * ms / 1000000; // uW*ms => mJ
+}
+
+/**
+  * Wakes up the GPS from the mode it has been put into by GPS_Suspend and
+  * starts acquisition. Returns false if the GPS could not be configured.
+  */
+bool GPS_Resume(void)
+{
+	if(gps_pm_awake) // Still searching
+		return true;
+
+	gps_pm_account(gps_pm_mode, gps_pm_power[gps_pm_mode], gps_pm_since);
+	gps_pm_stats[gps_pm_mode].wakeups++;
+	TRACE_INFO("GPS  > Resume from %s mode", gps_pm_names[gps_pm_mode]);
+
+	bool status = false;
+	switch(gps_pm_mode)
+	{
+		case GPS_PM_BACKUP:
+			// Receiver wakes up by itself
+			while(chVTGetSystemTimeX() < gps_pm_wake_at)
+				chThdSleepMilliseconds(GPS_POLL_INTERVAL);
+			for(uint8_t i=0; i<3 && !status; i++)
+				status = gps_configure();
+			if(!status) {
+				TRACE_ERROR("GPS  > Backup wakeup FAILED, power cycle GPS"); // TTFF still counts for backup
+				GPS_Deinit();
+				chThdSleepMilliseconds(100);
+				status = GPS_Init();
+			}
+			break;
+
+		case GPS_PM_CYCLIC:
+			if(!(status = gps_power_save(0)))
+				TRACE_ERROR("GPS  > Disable power save FAILED");
+			break;
+
+		default:
+			status = GPS_Init();
+	}
+
+	gps_pm_awake = true;
+	gps_pm_since = chVTGetSystemTimeX();
+	return status;
+}
+
+/**
+  * Chooses the mode with the least expected energy until the next lock.
+  * sleep is the time in ms until the next acquisition starts.
+  */
+static gps_pm_mode_t gps_pm_choose(uint16_t batt, uint32_t sleep)
+{
+	if(batt < GPS_ON_VBAT) // GPS will not be switched on in the next cycle
+		return GPS_PM_OFF;
+
+	gps_pm_mode_t best = GPS_PM_OFF;
+	uint64_t best_energy = UINT64_MAX;
+	for(gps_pm_mode_t mode=GPS_PM_OFF; mode<GPS_PM_MODES; mode++) {
+		uint64_t energy = (uint64_t)gps_pm_power[mode] * sleep + (uint64_t)GPS_PM_ACQ_POWER * gps_pm_stats[mode].ttff_avg;
+		if(energy < best_energy) {
+			best_energy = energy;
+			best = mode;
+		}
+	}
+	return best;
+}
+
+/**
+  * Ends the acquisition after GPS lock and puts the GPS to sleep until next,
+  * the time at which GPS_Resume is called again.
+  */
+void GPS_Suspend(uint16_t batt, systime_t next)
+{
+	if(!gps_pm_awake)
+		return;
+
+	// Statistics of the mode the GPS has been woken from
+	gps_pm_stats_t *st = &gps_pm_stats[gps_pm_mode];
+	uint32_t ttff = ST2MS(chVTTimeElapsedSinceX(gps_pm_since));
+	gps_pm_account(gps_pm_mode, GPS_PM_ACQ_POWER, gps_pm_since);
+	st->locks++;
+	st->ttff_avg += ((int32_t)ttff - (int32_t)st->ttff_avg) / GPS_PM_TTFF_WEIGHT;
+	if(ttff > st->ttff_max)
+		st->ttff_max = ttff;
+	TRACE_INFO("GPS  > Lock from %s mode after %d ms (avg %d ms, max %d ms, %d locks, %d mJ)",
+		gps_pm_names[gps_pm_mode], ttff, st->ttff_avg, st->ttff_max, st->locks, st->energy);
+
+	systime_t now = chVTGetSystemTimeX();
+	uint32_t sleep = next > now ? ST2MS(next - now) : 0;
+	gps_pm_mode = gps_pm_choose(batt, sleep);
+	TRACE_INFO("GPS  > Suspend in %s mode for %d ms", gps_pm_names[gps_pm_mode], sleep);
+
+	switch(gps_pm_mode)
+	{
+		case GPS_PM_BACKUP:
+			// Wake up a bit early, so the receiver is ready when resumed
+			sleep = sleep > GPS_PM_WAKE_AHEAD + 1000 ? sleep - GPS_PM_WAKE_AHEAD : 1000;
+			gps_pm_wake_at = now + MS2ST(sleep);
+			gps_backup(sleep);
+			break;
+
+		case GPS_PM_CYCLIC:
+			if(!gps_power_save(1)) {
+				TRACE_ERROR("GPS  > Enable power save FAILED, switch off GPS");
+				gps_pm_mode = GPS_PM_OFF;
+				GPS_Deinit();
+			}
+			break;
+
+		default:
+			GPS_Deinit();
+	}
+
+	gps_pm_awake = false;
+	gps_pm_since = chVTGetSystemTimeX();
+}
+
+/**
+  * Switches off the GPS (e.g. at low battery), regardless of its mode
+  */
+void GPS_PowerOff(void)
+{
+	if(!gps_pm_awake && gps_pm_mode == GPS_PM_OFF) // Already off
+		return;
+
+	if(gps_pm_awake)
+		gps_pm_account(gps_pm_mode, GPS_PM_ACQ_POWER, gps_pm_since);
+	else
+		gps_pm_account(gps_pm_mode, gps_pm_power[gps_pm_mode], gps_pm_since);
+
+	GPS_Deinit();
+	gps_pm_mode = GPS_PM_OFF;
+	gps_pm_awake = false;
+	gps_pm_since = chVTGetSystemTimeX();
+}
+
+/**
+  * Copies the per mode statistics (GPS_PM_MODES entries) for tuning
+  */
+void GPS_GetPowerStats(gps_pm_stats_t *stats)
+{
+	memcpy(stats, gps_pm_stats, sizeof(gps_pm_stats));
+}
+
 /**
   * Returns accurate MCU frequency in 40Hz steps. The frequency is measured by
   * the GPS timepulse. So it requires GPS lock. This function will timeout
@@ -13,6 +13,30 @@
 
 #define isGPSLocked(pos) ((pos)->type == 3 && (pos)->num_svs >= 5)
 
+#define GPS_PM_ACQ_POWER	75000	/* Power in uW while acquiring/tracking continuously */
+#define GPS_PM_CYCLIC_POWER	20000	/* Average power in uW in cyclic tracking */
+#define GPS_PM_BACKUP_POWER	100		/* Power in uW in software backup */
+#define GPS_PM_TTFF_OFF		30000	/* Initial TTFF estimate in ms after switching on */
+#define GPS_PM_TTFF_BACKUP	5000	/* Initial TTFF estimate in ms after backup (hot start) */
+#define GPS_PM_TTFF_CYCLIC	1000	/* Initial TTFF estimate in ms in cyclic tracking */
+#define GPS_PM_TTFF_WEIGHT	4		/* Weight of the TTFF average, new TTFF counts 1/n */
+#define GPS_PM_WAKE_AHEAD	2000	/* Time in ms the GPS wakes up from backup before resumed */
+
+typedef enum {
+	GPS_PM_OFF,			// Switched off
+	GPS_PM_BACKUP,		// Software backup, ephemeris retained
+	GPS_PM_CYCLIC,		// Cyclic tracking (power save mode)
+	GPS_PM_MODES
+} gps_pm_mode_t;
+
+typedef struct {
+	uint32_t wakeups;	// Resumes from this mode
+	uint32_t locks;		// Locks after resume from this mode
+	uint32_t ttff_avg;	// Average time to first fix in ms
+	uint32_t ttff_max;	// Longest time to first fix in ms
+	uint32_t energy;	// Estimated GPS energy in mJ (sleeping in and acquiring after this mode)
+} gps_pm_stats_t;
+
 typedef struct {
 	ptime_t time;		// Time
 	uint8_t type;		// type of fix (validity)
@@ -28,10 +52,16 @@ uint8_t gps_set_airborne_model(void);
 uint8_t gps_set_power_save(void);
 uint8_t gps_power_save(int on);
 //uint8_t gps_save_settings(void);
+uint8_t gps_set_periodic_pvt(void);
 bool gps_get_fix(gpsFix_t *fix);
+uint32_t gps_latest_fix(gpsFix_t *fix);
 
 bool GPS_Init(void);
 void GPS_Deinit(void);
+bool GPS_Resume(void);
+void GPS_Suspend(uint16_t batt, systime_t next);
+void GPS_PowerOff(void);
+void GPS_GetPowerStats(gps_pm_stats_t *stats);
 uint32_t GPS_get_mcu_frequency(void);
 
 #endif
@@ -28,12 +28,26 @@
 #include "board.h"
 #include "defines.h"
 #include "debug.h"
+#include "modules.h"
 #include <string.h>
 
 #define OV2640_I2C_ADR			0x30
 #define DCMI_BASE_ADR			((uint32_t)0x50050000)
 #define DCMI_REG_DR_OFFSET		0x28
 #define DCMI_REG_DR_ADDRESS		(DCMI_BASE_ADR | DCMI_REG_DR_OFFSET)
+#define OV2640_EOI_WINDOW		4096 /* Bytes searched backwards for the JPEG EOI marker */
+#define OV2640_WARMUP_FRAMES	10   /* Frames the sensor needs until exposure has settled */
+#define OV2640_WARMUP_TIMEOUT	3000 /* Max. time in ms to wait for the warm-up frames */
+#define OV2640_SETTLE_FRAMES	3    /* Frames to skip after a reconfiguration of the running sensor */
+#define OV2640_CAPTURE_TIMEOUT	2000 /* Max. time in ms to wait for a frame */
+#define OV2640_POWERUP_TIMEOUT	100  /* Max. time in ms until the sensor answers after power on */
+#define OV2640_POWERUP_POLL		10   /* Interval in ms the sensor ID is polled after power on */
+#define OV2640_REDETECT_TIME	600  /* Time in s an absent camera isn't probed again */
+#define OV2640_DCMI_IRQ_PRIORITY 6
+
+#ifndef STM32_DCMI_HANDLER
+#define STM32_DCMI_HANDLER		Vector178
+#endif
 
 
 #define VAL_SET(x, mask, rshift, lshift)  \
@@ -640,8 +654,105 @@ static const struct regval_list ov2640_jpeg_regs[] = {
 bool ov2640_samplingFinished;
 ssdv_config_t *ov2640_config;
 
+static const struct ov2640_win_size *ov2640_res_win[] = {
+	[RES_QCIF]	= &ov2640_supported_win_sizes[0],
+	[RES_QVGA]	= &ov2640_supported_win_sizes[1],
+	[RES_VGA]	= &ov2640_supported_win_sizes[3],
+	[RES_XGA]	= &ov2640_supported_win_sizes[5],
+	[RES_UXGA]	= &ov2640_supported_win_sizes[7],
+};
+
+/* Quantization scale (QS) per quality level, lower values give larger and
+ * better images. Level 5 is the scale of the original register set. */
+static const uint8_t ov2640_qs[OV2640_QUALITY_MAX] = {
+	0x30, 0x24, 0x1a, 0x12, 0x0c, 0x0a, 0x08, 0x06
+};
+
+static bool ov2640_powered;				// Camera switched on (and I2C locked) by OV2640_init
+static bool ov2640_programmed;			// Init registers written since power on
+static uint8_t ov2640_bank = 0xff;		// Selected register bank (0xff = unknown)
+static uint16_t ov2640_reg_writes;		// Registers written by the last config
+
+typedef enum {
+	OV2640_UNKNOWN,						// Not detected yet
+	OV2640_PRESENT,						// Sensor answered with its ID
+	OV2640_ABSENT						// Sensor didn't answer
+} ov2640_detect_t;
+
+static ov2640_detect_t ov2640_detected = OV2640_UNKNOWN;
+static systime_t ov2640_detect_time;	// Time of the last detection
+
+static binary_semaphore_t ov2640_bsem;	// Signalled by frame end, DMA completion/error and warm-up
+static volatile uint32_t ov2640_vsync_count; // VSYNC events left until the warm-up is done
+static volatile bool ov2640_capture_error; // DMA transfer error or DCMI error during capture
+
+static uint32_t ov2640_frame_size;		// JPEG size of the last capture (0 = nothing captured)
+static bool ov2640_frame_overflow;		// Last capture didn't fit into the buffer
+
+static ov2640_blackout_t ov2640_blackout; // Radio blackout caused by DCMI sampling
+
+/**
+  * Determines the JPEG size of the last capture. Disabling the DMA stream
+  * flushes its FIFO into the buffer, so the bytes written follow from the
+  * remaining transfer count (NDTR). The JPEG EOI marker (FF D9) is then
+  * searched for just below that point, since the DCMI transfers whole
+  * words and the sensor may pad the end of the frame.
+  * Returns true if the EOI marker has been found.
+  */
+static bool OV2640_DetectFrameSize(void)
+{
+	const stm32_dma_stream_t *stream = STM32_DMA2_STREAM1;
+	uint8_t *buffer = ov2640_config->ram_buffer;
+
+	dmaStreamDisable(stream);
+
+	uint32_t remaining = dmaStreamGetTransactionSize(stream);
+	uint32_t written = (ov2640_config->ram_size / sizeof(uint32_t) - remaining) * sizeof(uint32_t);
+	uint32_t stop = written > OV2640_EOI_WINDOW ? written - OV2640_EOI_WINDOW : 0;
+
+	ov2640_frame_overflow = remaining == 0;
+
+	for(uint32_t i=written; i>=stop+2; i--)
+		if(buffer[i-2] == 0xFF && buffer[i-1] == 0xD9) {
+			ov2640_frame_size = i;
+			return true;
+		}
+
+	// No EOI, the frame is truncated or broken
+	ov2640_frame_size = written;
+	return false;
+}
+
+/**
+  * Waits until the sensor has delivered a number of frames (counted by
+  * VSYNC). Used instead of a fixed delay to let the sensor warm up.
+  */
+static bool OV2640_WaitFrames(uint32_t frames, uint32_t timeout)
+{
+	systime_t start = chVTGetSystemTimeX();
+
+	chBSemReset(&ov2640_bsem, true);
+	ov2640_vsync_count = frames;
+	DCMI->ICR = DCMI_IT_VSYNC;
+	DCMI->IER |= DCMI_IT_VSYNC;
+
+	msg_t msg = chBSemWaitTimeout(&ov2640_bsem, MS2ST(timeout));
+
+	DCMI->IER &= ~DCMI_IT_VSYNC;
+	ov2640_vsync_count = 0;
+
+	if(msg == MSG_OK) {
+		TRACE_INFO("CAM  > Sensor ready after %d ms", ST2MS(chVTTimeElapsedSinceX(start)));
+	} else {
+		TRACE_WARN("CAM  > Sensor not ready after %d ms", timeout);
+	}
+	return msg == MSG_OK;
+}
+
 /**
-  * Captures an image from the camera.
+  * Captures an image from the camera. Returns when the frame has been
+  * sampled completely, or it didn't fit into the buffer. Returns false on
+  * timeout, transfer errors or if the frame has no JPEG EOI marker.
   */
 bool OV2640_Snapshot2RAM(void)
 {
@@ -649,36 +760,125 @@ bool OV2640_Snapshot2RAM(void)
 
 	// Capture enable
 	TRACE_INFO("CAM  > Capture image");
+	systime_t start = chVTGetSystemTimeX();
+
+	// Radios are excluded only while the frame is sampled. They are switched
+	// off whenever the mutex is free, so there is nothing to shut down here.
+	chMtxLock(&interference_mtx);
+	systime_t blackout = chVTGetSystemTimeX();
+
+	chBSemReset(&ov2640_bsem, true);
+	ov2640_samplingFinished = false;
+	ov2640_capture_error = false;
+	OV2640_ArmDMA();
+	DCMI->ICR = DCMI_IT_FRAME | DCMI_IT_OVF | DCMI_IT_ERR;
+	DCMI->IER |= DCMI_IT_FRAME | DCMI_IT_OVF | DCMI_IT_ERR;
 	OV2640_CaptureDCMI();
-	chThdSleepMilliseconds(1000);
+
+	msg_t msg = chBSemWaitTimeout(&ov2640_bsem, MS2ST(OV2640_CAPTURE_TIMEOUT));
+
+	DCMI->IER &= ~(DCMI_IT_FRAME | DCMI_IT_OVF | DCMI_IT_ERR);
+	DCMI->CR &= ~DCMI_CR_CAPTURE;
+
+	blackout = chVTTimeElapsedSinceX(blackout);
+	chMtxUnlock(&interference_mtx);
+
+	ov2640_blackout.samplings++;
+	ov2640_blackout.total += blackout;
+	if(blackout > ov2640_blackout.longest)
+		ov2640_blackout.longest = blackout;
+
+	bool eoi = OV2640_DetectFrameSize();
 
 	palSetPad(PORT(LED_2YELLOW), PIN(LED_2YELLOW));
 
+	if(msg != MSG_OK) {
+		TRACE_ERROR("CAM  > Capture timeout after %d ms", OV2640_CAPTURE_TIMEOUT);
+		return false;
+	}
+	if(ov2640_frame_overflow) {
+		TRACE_WARN("CAM  > Image doesn't fit into buffer (%d byte)", ov2640_config->ram_size);
+		return true;
+	}
+	if(ov2640_capture_error) {
+		TRACE_ERROR("CAM  > Transfer error");
+		return false;
+	}
+	if(!eoi) {
+		TRACE_ERROR("CAM  > No JPEG EOI found (%d bytes sampled)", ov2640_frame_size);
+		return false;
+	}
+
+	TRACE_INFO("CAM  > Captured %d bytes in %d ms", ov2640_frame_size, ST2MS(chVTTimeElapsedSinceX(start)));
 	return true;
 }
 
+/**
+  * Returns the radio blackout accumulated by captures since the last reset
+  */
+void OV2640_GetBlackout(ov2640_blackout_t *blackout, bool reset)
+{
+	*blackout = ov2640_blackout;
+	if(reset)
+		memset(&ov2640_blackout, 0, sizeof(ov2640_blackout));
+}
+
 bool OV2640_BufferOverflow(void)
 {
-	return OV2640_getBuffer(NULL) > ov2640_config->ram_size-3;
+	return ov2640_frame_overflow;
 }
 
 uint32_t OV2640_getBuffer(uint8_t** buffer) {
+	if(!ov2640_config) { // Nothing captured yet
+		*buffer = NULL;
+		return 0;
+	}
+
 	*buffer = ov2640_config->ram_buffer;
+	return ov2640_frame_size;
+}
+
+/**
+  * DMA interrupt, transfer complete means the buffer is full
+  */
+static void OV2640_dma_avail(void *p, uint32_t flags)
+{
+	(void)p;
 
-	// Detect size
-	uint32_t size = ov2640_config->ram_size;
-	while(!ov2640_config->ram_buffer[size-1])
-		size--;
+	if(flags & STM32_DMA_ISR_TEIF)
+		ov2640_capture_error = true;
 
-	return size;
+	chSysLockFromISR();
+	chBSemSignalI(&ov2640_bsem);
+	chSysUnlockFromISR();
 }
 
-void OV2640_dma_avail(uint32_t flags)
+/**
+  * DCMI interrupt, frame end (capture) and VSYNC (warm-up)
+  */
+CH_IRQ_HANDLER(STM32_DCMI_HANDLER)
 {
-	(void)flags;
-	TRACE_DEBUG("DMA Interrupt");
-	ov2640_samplingFinished = true;
-	dmaStreamDisable(STM32_DMA2_STREAM1);
+	CH_IRQ_PROLOGUE();
+
+	uint32_t flags = DCMI->MISR;
+	DCMI->ICR = flags;
+
+	chSysLockFromISR();
+	if((flags & DCMI_IT_VSYNC) && ov2640_vsync_count) {
+		if(--ov2640_vsync_count == 0)
+			chBSemSignalI(&ov2640_bsem);
+	}
+	if(flags & (DCMI_IT_OVF | DCMI_IT_ERR)) {
+		ov2640_capture_error = true;
+		chBSemSignalI(&ov2640_bsem);
+	}
+	if(flags & DCMI_IT_FRAME) {
+		ov2640_samplingFinished = true;
+		chBSemSignalI(&ov2640_bsem);
+	}
+	chSysUnlockFromISR();
+
+	CH_IRQ_EPILOGUE();
 }
 
 /**
@@ -688,23 +888,37 @@ void OV2640_InitDMA(void)
 {
 	TRACE_INFO("CAM  > Available buffer %d byte", ov2640_config->ram_size);
 	const stm32_dma_stream_t *stream = STM32_DMA2_STREAM1;
-	dmaStreamAllocate(stream, 2, (stm32_dmaisr_t)OV2640_dma_avail, NULL);
+	dmaStreamAllocate(stream, 2, OV2640_dma_avail, NULL);
 	dmaStreamSetPeripheral(stream, ((uint32_t*)DCMI_REG_DR_ADDRESS));
-	dmaStreamSetMemory0(stream, (uint32_t)ov2640_config->ram_buffer);
-	dmaStreamSetTransactionSize(stream, ov2640_config->ram_size / sizeof(uint32_t));
 	dmaStreamSetMode(stream, STM32_DMA_CR_CHSEL(1) | STM32_DMA_CR_DIR_P2M |
 							 STM32_DMA_CR_MINC | STM32_DMA_CR_PSIZE_WORD |
 							 STM32_DMA_CR_MSIZE_WORD | STM32_DMA_CR_MBURST_SINGLE |
 							 STM32_DMA_CR_PBURST_SINGLE | STM32_DMA_CR_TEIE |
-							 STM32_DMA_CR_PL(3));
+							 STM32_DMA_CR_TCIE | STM32_DMA_CR_PL(3));
 	dmaStreamSetFIFO(stream, STM32_DMA_FCR_FTH_FULL);
+}
+
+/**
+  * Points the DMA to the start of the buffer for the next capture. The
+  * remaining transfer count tells the frame size afterwards.
+  */
+void OV2640_ArmDMA(void)
+{
+	const stm32_dma_stream_t *stream = STM32_DMA2_STREAM1;
+	dmaStreamDisable(stream);
+	dmaStreamSetMemory0(stream, (uint32_t)ov2640_config->ram_buffer);
+	dmaStreamSetTransactionSize(stream, ov2640_config->ram_size / sizeof(uint32_t));
 	dmaStreamEnable(stream);
+
+	ov2640_frame_size = 0;
+	ov2640_frame_overflow = false;
 }
 
 void OV2640_DeinitDMA(void)
 {
 	const stm32_dma_stream_t *stream = STM32_DMA2_STREAM1;
 	dmaStreamDisable(stream);
+	dmaStreamRelease(stream);
 }
 
 /**
@@ -719,6 +933,12 @@ void OV2640_InitDCMI(void)
 	// Configure DCMI
 	DCMI->CR = DCMI_CaptureMode_SnapShot | DCMI_CR_JPEG | DCMI_CR_PCKPOL;
 
+	// Interrupts are enabled while waiting for them
+	chBSemObjectInit(&ov2640_bsem, true);
+	DCMI->IER = 0;
+	DCMI->ICR = DCMI_IT_FRAME | DCMI_IT_OVF | DCMI_IT_ERR | DCMI_IT_VSYNC | DCMI_IT_LINE;
+	nvicEnableVector(DCMI_IRQn, OV2640_DCMI_IRQ_PRIORITY);
+
 	// DCMI enable
 	DCMI->CR |= (uint32_t)DCMI_CR_ENABLE;
 }
@@ -731,9 +951,12 @@ void OV2640_CaptureDCMI(void)
 
 void OV2640_DeinitDCMI(void)
 {
-	// Clock enable
-	RCC->AHB2ENR &= ~RCC_AHB2Periph_DCMI;
+	nvicDisableVector(DCMI_IRQn);
+	DCMI->IER = 0;
+
+	// Clock disable
 	DCMI->CR &= ~(DCMI_CR_ENABLE | DCMI_CR_CAPTURE);
+	RCC->AHB2ENR &= ~RCC_AHB2Periph_DCMI;
 }
 
 /**
@@ -757,83 +980,172 @@ void OV2640_InitGPIO(void)
 	palSetPadMode(PORT(CAM_EN), PIN(CAM_EN), PAL_MODE_OUTPUT_PUSHPULL);		// CAM_EN
 }
 
+/**
+  * Writes one register, the bank selection is skipped if the bank is
+  * already selected.
+  */
+static void OV2640_WriteReg(uint8_t reg, uint8_t val)
+{
+	if(reg == BANK_SEL) {
+		if(ov2640_bank == val)
+			return;
+		ov2640_bank = val;
+	}
+
+	I2C_write8_locked(OV2640_I2C_ADR, reg, val);
+	ov2640_reg_writes++;
+}
+
+/**
+  * Writes a register table (terminated by ENDMARKER). Redundant bank
+  * selections are skipped. SCCB only guarantees single register writes,
+  * so every register is a transaction of its own.
+  */
+static void OV2640_WriteRegs(const struct regval_list *regs)
+{
+	for(uint32_t i=0; (regs[i].reg != 0xff) || (regs[i].val != 0xff); i++)
+		OV2640_WriteReg(regs[i].reg, regs[i].val);
+}
+
+/**
+  * Transmits the configuration for the selected resolution. The reset and
+  * init registers are only written once after power on, a resolution
+  * change only needs the size and format registers.
+  */
 void OV2640_TransmitConfig(void)
 {
-	// Set to page 1
-	I2C_write8_locked(OV2640_I2C_ADR, 0xff, 0x01);
-	I2C_write8_locked(OV2640_I2C_ADR, 0x12, 0x80);
-	chThdSleepMilliseconds(50);
+	systime_t start = chVTGetSystemTimeX();
+	const struct ov2640_win_size *win = ov2640_config->res < RES_MAX ? ov2640_res_win[ov2640_config->res] : ov2640_res_win[RES_QVGA];
+	bool full = !ov2640_programmed;
 
-	/* Write selected arrays to the camera to initialize it and set the
-	 * desired output format. */
-	for(uint32_t i=0; (ov2640_init_regs[i].reg != 0xff) || (ov2640_init_regs[i].val != 0xff); i++)
-		I2C_write8_locked(OV2640_I2C_ADR, ov2640_init_regs[i].reg, ov2640_init_regs[i].val);
-
-	for(uint32_t i=0; (ov2640_size_change_preamble_regs[i].reg != 0xff) || (ov2640_size_change_preamble_regs[i].val != 0xff); i++)
-		I2C_write8_locked(OV2640_I2C_ADR, ov2640_size_change_preamble_regs[i].reg, ov2640_size_change_preamble_regs[i].val);
-
-	switch(ov2640_config->res) {
-		case RES_QCIF:
-			for(uint32_t i=0; (ov2640_qcif_regs[i].reg != 0xff) || (ov2640_qcif_regs[i].val != 0xff); i++)
-				I2C_write8_locked(OV2640_I2C_ADR, ov2640_qcif_regs[i].reg, ov2640_qcif_regs[i].val);
-			break;
-
-		case RES_QVGA:
-			for(uint32_t i=0; (ov2640_qvga_regs[i].reg != 0xff) || (ov2640_qvga_regs[i].val != 0xff); i++)
-				I2C_write8_locked(OV2640_I2C_ADR, ov2640_qvga_regs[i].reg, ov2640_qvga_regs[i].val);
-			break;
-
-		case RES_VGA:
-			for(uint32_t i=0; (ov2640_vga_regs[i].reg != 0xff) || (ov2640_vga_regs[i].val != 0xff); i++)
-				I2C_write8_locked(OV2640_I2C_ADR, ov2640_vga_regs[i].reg, ov2640_vga_regs[i].val);
-			break;
-
-		case RES_XGA:
-			for(uint32_t i=0; (ov2640_xga_regs[i].reg != 0xff) || (ov2640_xga_regs[i].val != 0xff); i++)
-				I2C_write8_locked(OV2640_I2C_ADR, ov2640_xga_regs[i].reg, ov2640_xga_regs[i].val);
-			break;
-
-		case RES_UXGA:
-			for(uint32_t i=0; (ov2640_uxga_regs[i].reg != 0xff) || (ov2640_uxga_regs[i].val != 0xff); i++)
-				I2C_write8_locked(OV2640_I2C_ADR, ov2640_uxga_regs[i].reg, ov2640_uxga_regs[i].val);
-			break;
-
-		default: // Default QVGA
-			for(uint32_t i=0; (ov2640_qvga_regs[i].reg != 0xff) || (ov2640_qvga_regs[i].val != 0xff); i++)
-				I2C_write8_locked(OV2640_I2C_ADR, ov2640_qvga_regs[i].reg, ov2640_qvga_regs[i].val);
+	ov2640_reg_writes = 0;
+
+	if(full) {
+		// Reset all registers
+		OV2640_WriteReg(BANK_SEL, BANK_SEL_SENS);
+		OV2640_WriteReg(COM7, COM7_SRST);
+		ov2640_bank = 0xff; // Bank after reset unknown
+		chThdSleepMilliseconds(50);
+
+		OV2640_WriteRegs(ov2640_init_regs);
 	}
 
-	for(uint32_t i=0; (ov2640_format_change_preamble_regs[i].reg != 0xff) || (ov2640_format_change_preamble_regs[i].val != 0xff); i++)
-		I2C_write8_locked(OV2640_I2C_ADR, ov2640_format_change_preamble_regs[i].reg, ov2640_format_change_preamble_regs[i].val);
-	for(uint32_t i=0; (ov2640_yuyv_regs[i].reg != 0xff) || (ov2640_yuyv_regs[i].val != 0xff); i++)
-		I2C_write8_locked(OV2640_I2C_ADR, ov2640_yuyv_regs[i].reg, ov2640_yuyv_regs[i].val);
+	/* Write selected arrays to the camera to set the resolution and the
+	 * desired output format. */
+	OV2640_WriteRegs(ov2640_size_change_preamble_regs);
+	OV2640_WriteRegs(win->regs);
+	OV2640_WriteRegs(ov2640_format_change_preamble_regs);
+	OV2640_WriteRegs(ov2640_yuyv_regs);
+	OV2640_WriteRegs(ov2640_jpeg_regs);
+
+	// JPEG quality
+	uint8_t quality = OV2640_Quality(ov2640_config->quality);
+	OV2640_WriteReg(BANK_SEL, BANK_SEL_DSP);
+	OV2640_WriteReg(QS, ov2640_qs[quality-1]);
+
+	ov2640_programmed = true;
+
+	TRACE_INFO("CAM  > Config %s Q%d (%s) in %d ms, %d registers written",
+		win->name, quality, full ? "full" : "resolution only", ST2MS(chVTTimeElapsedSinceX(start)),
+		ov2640_reg_writes);
+}
 
-	for(uint32_t i=0; (ov2640_jpeg_regs[i].reg != 0xff) || (ov2640_jpeg_regs[i].val != 0xff); i++)
-		I2C_write8_locked(OV2640_I2C_ADR, ov2640_jpeg_regs[i].reg, ov2640_jpeg_regs[i].val);
+/**
+  * Maps a configured JPEG quality to a valid level, 0 selects the default
+  */
+uint8_t OV2640_Quality(uint8_t quality)
+{
+	if(!quality)
+		return OV2640_QUALITY_DEFAULT;
+	return quality > OV2640_QUALITY_MAX ? OV2640_QUALITY_MAX : quality;
 }
 
-void OV2640_init(ssdv_config_t *config) {
-	ov2640_config = config;
+/**
+  * Returns the average luminance (YAVG) of the last frame as a scene
+  * brightness hint, 0 if the camera is switched off
+  */
+uint8_t OV2640_GetBrightness(void)
+{
+	uint8_t val;
 
-	// Take I2C (due to silicon bug of OV2640, it interferes if byte 0x30 transmitted on I2C bus)
-	I2C_lock();
+	if(!ov2640_powered)
+		return 0;
 
-	// Clearing buffer
-	uint32_t i;
-	for(i=0; i<ov2640_config->ram_size; i++)
-		ov2640_config->ram_buffer[i] = 0;
+	OV2640_WriteReg(BANK_SEL, BANK_SEL_SENS);
+	if(!I2C_read8_locked(OV2640_I2C_ADR, YAVG, &val))
+		return 0;
+	return val;
+}
 
-	TRACE_INFO("CAM  > Init pins");
-	OV2640_InitGPIO();
+/**
+  * Polls the sensor ID after power on, which replaces a fixed power up delay.
+  * The result is remembered for OV2640_isAvailable.
+  */
+static bool OV2640_Detect(void)
+{
+	systime_t start = chVTGetSystemTimeX();
+	uint16_t val = 0;
+	bool found;
+
+	do {
+		chThdSleepMilliseconds(OV2640_POWERUP_POLL);
+		found = I2C_read16_locked(OV2640_I2C_ADR, 0x0A, &val) && val == PID_OV2640;
+	} while(!found && chVTTimeElapsedSinceX(start) < MS2ST(OV2640_POWERUP_TIMEOUT));
+
+	ov2640_detected = found ? OV2640_PRESENT : OV2640_ABSENT;
+	ov2640_detect_time = chVTGetSystemTimeX();
+
+	if(found) {
+		TRACE_INFO("CAM  > OV2640 detected in %d ms", ST2MS(chVTTimeElapsedSinceX(start)));
+	} else {
+		TRACE_ERROR("CAM  > OV2640 not detected (PID=%04x)", val);
+	}
+	return found;
+}
 
-	// Power on OV2640
-	TRACE_INFO("CAM  > Switch on");
-	palSetPad(PORT(CAM_EN), PIN(CAM_EN)); // Switch off camera
+/**
+  * Switches the camera on (if not yet) and configures it. The sensor is
+  * detected during power up. Returns false if no camera answered, the
+  * camera is switched off again then.
+  */
+bool OV2640_init(ssdv_config_t *config) {
+	ov2640_config = config;
+	bool running = ov2640_powered;
+
+	// Camera may still be on if only the resolution or quality is changed
+	if(!running) {
+		// Take I2C (due to silicon bug of OV2640, it interferes if byte 0x30 transmitted on I2C bus)
+		I2C_lock();
+
+		TRACE_INFO("CAM  > Init pins");
+		OV2640_InitGPIO();
+
+		// Power on OV2640
+		TRACE_INFO("CAM  > Switch on");
+		palSetPad(PORT(CAM_EN), PIN(CAM_EN)); // Switch on camera
+
+		ov2640_powered = true;
+		ov2640_programmed = false;
+		ov2640_bank = 0xff;
+
+		if(!OV2640_Detect()) {
+			palClearPad(PORT(CAM_EN), PIN(CAM_EN)); // Switch off camera
+			ov2640_powered = false;
+			I2C_unlock();
+			return false;
+		}
+	}
 
 	// Send settings to OV2640
 	TRACE_INFO("CAM  > Transmit config to camera");
 	OV2640_TransmitConfig();
 
+	if(running) {
+		// Exposure has settled already, skip the frames of the old config
+		OV2640_WaitFrames(OV2640_SETTLE_FRAMES, OV2640_WARMUP_TIMEOUT);
+		return true;
+	}
+
 	// DCMI DMA
 	TRACE_INFO("CAM  > Init DMA");
 	OV2640_InitDMA();
@@ -842,10 +1154,15 @@ void OV2640_init(ssdv_config_t *config) {
 	TRACE_INFO("CAM  > Init DCMI");
 	OV2640_InitDCMI();
 
-	chThdSleepMilliseconds(3000);
+	// Wait until the sensor delivers frames and exposure has settled
+	OV2640_WaitFrames(OV2640_WARMUP_FRAMES, OV2640_WARMUP_TIMEOUT);
+	return true;
 }
 
 void OV2640_deinit(void) {
+	if(!ov2640_powered) // DCMI and DMA are only set up while switched on
+		return;
+
 	// DCMI Init
 	TRACE_INFO("CAM  > Deinit DCMI");
 	OV2640_DeinitDCMI();
@@ -858,27 +1175,23 @@ void OV2640_deinit(void) {
 	TRACE_INFO("CAM  > Switch off");
 	palClearPad(PORT(CAM_EN), PIN(CAM_EN)); // Switch off camera
 
+	ov2640_powered = false;
+	ov2640_programmed = false;
+
 	// Release I2C (due to silicon bug of OV2640, it interferes if byte 0x30 transmitted on I2C bus)
 	I2C_unlock();
 }
 
+/**
+  * Returns false if the camera is known to be absent. The camera isn't
+  * switched on for this, detection takes place in OV2640_init. An absent
+  * camera is probed again by OV2640_init after OV2640_REDETECT_TIME.
+  */
 bool OV2640_isAvailable(void)
 {
-	I2C_lock();
-	palSetPad(PORT(CAM_EN), PIN(CAM_EN)); // Switch on camera
-
-	chThdSleepMilliseconds(100);
-
-	uint16_t val;
-	bool ret;
-	if(I2C_read16_locked(OV2640_I2C_ADR, 0x0A, &val))
-		ret = val == PID_OV2640;
-	else
-		ret = false;
-
-	palClearPad(PORT(CAM_EN), PIN(CAM_EN)); // Switch off camera
-	I2C_unlock();
+	if(ov2640_powered || ov2640_detected != OV2640_ABSENT)
+		return true;
 
-	return ret;
+	return chVTTimeElapsedSinceX(ov2640_detect_time) >= S2ST(OV2640_REDETECT_TIME);
 }
 
@@ -9,8 +9,19 @@
 #include "hal.h"
 #include "types.h"
 
+#define OV2640_QUALITY_MIN		1	/* Lowest JPEG quality */
+#define OV2640_QUALITY_MAX		8	/* Highest JPEG quality */
+#define OV2640_QUALITY_DEFAULT	5	/* Quality if none configured */
+
+typedef struct {
+	uint16_t	samplings;	// Frames sampled by DCMI
+	systime_t	total;		// Time the radios were locked out
+	systime_t	longest;	// Longest single lockout
+} ov2640_blackout_t;
+
 bool OV2640_Snapshot2RAM(void);
 void OV2640_InitDMA(void);
+void OV2640_ArmDMA(void);
 void OV2640_DeinitDMA(void);
 void OV2640_InitDCMI(void);
 void OV2640_CaptureDCMI(void);
@@ -19,8 +30,11 @@ void OV2640_InitGPIO(void);
 uint32_t OV2640_getBuffer(uint8_t** buffer);
 bool OV2640_BufferOverflow(void);
 void OV2640_TransmitConfig(void);
-void OV2640_init(ssdv_config_t *config);
+bool OV2640_init(ssdv_config_t *config);
 void OV2640_deinit(void);
 bool OV2640_isAvailable(void);
+uint8_t OV2640_Quality(uint8_t quality);
+uint8_t OV2640_GetBrightness(void);
+void OV2640_GetBlackout(ov2640_blackout_t *blackout, bool reset);
 
 #endif
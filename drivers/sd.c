@@ -3,10 +3,80 @@
 #include "ff.h"
 #include "debug.h"
 #include "config.h"
+#include "ptime.h"
+#include "sd.h"
+#include <string.h>
 
 MMCDriver MMCD1;
 bool sdInitialized = false;
 
+static FATFS fs;				// Mounted once by initSD
+static FIL archive;				// Image archive, kept open
+static bool archiveOpen = false;
+static uint32_t archivePos;		// Write position of the next record
+
+/**
+  * Searches the end of the record chain. Records are sector aligned and the
+  * chain ends with an empty header, so the archive is used as a ring.
+  */
+static uint32_t archiveFindEnd(void)
+{
+	sd_archive_hdr_t hdr;
+	uint32_t pos = 0;
+	UINT len;
+
+	while(pos + sizeof(hdr) <= SD_ARCHIVE_SIZE)
+	{
+		if(f_lseek(&archive, pos) != FR_OK || f_read(&archive, &hdr, sizeof(hdr), &len) != FR_OK
+				|| len != sizeof(hdr) || hdr.magic != SD_ARCHIVE_MAGIC)
+			break;
+		pos += SD_ARCHIVE_RECLEN(hdr.len);
+	}
+	return pos < SD_ARCHIVE_SIZE ? pos : 0;
+}
+
+/**
+  * Opens the image archive. Its whole size is allocated only when the file is
+  * created or has the wrong size, so the clusters are linked before the first
+  * image has to be stored and later boots don't walk the cluster chain again.
+  */
+static void archiveInit(void)
+{
+	FRESULT res;
+
+	res = f_open(&archive, SD_ARCHIVE_FILE, FA_OPEN_ALWAYS | FA_READ | FA_WRITE);
+	if(res != FR_OK) {
+		TRACE_ERROR("SD   > Opening archive failed (err=%d)", res);
+		return;
+	}
+
+	if(f_size(&archive) != SD_ARCHIVE_SIZE)
+	{
+		// This FatFs revision has no f_expand, seeking beyond the end of the
+		// file extends the cluster chain (contiguous on an unfragmented card)
+		TRACE_INFO("SD   > Allocate archive (%d bytes, was %d bytes)", SD_ARCHIVE_SIZE, f_size(&archive));
+		systime_t start = chVTGetSystemTimeX();
+		sd_archive_hdr_t end;
+		UINT len;
+		memset(&end, 0, sizeof(end));
+		bool fresh = f_size(&archive) == 0;
+		bool oversize = f_size(&archive) > SD_ARCHIVE_SIZE;
+		if((res = f_lseek(&archive, SD_ARCHIVE_SIZE)) != FR_OK || f_tell(&archive) != SD_ARCHIVE_SIZE
+				|| (oversize && (res = f_truncate(&archive)) != FR_OK)
+				|| (fresh && ((res = f_lseek(&archive, 0)) != FR_OK || (res = f_write(&archive, &end, sizeof(end), &len)) != FR_OK))
+				|| (res = f_sync(&archive)) != FR_OK) {
+			TRACE_ERROR("SD   > Allocating archive failed (err=%d)", res);
+			f_close(&archive);
+			return;
+		}
+		TRACE_INFO("SD   > Archive allocated in %d ms", ST2MS(chVTTimeElapsedSinceX(start)));
+	}
+
+	archivePos = archiveFindEnd();
+	archiveOpen = true;
+	TRACE_INFO("SD   > Archive opened (pos=%d)", archivePos);
+}
+
 bool initSD(void)
 {
 	TRACE_INFO("SD   > Initialize SD card");
@@ -37,80 +107,74 @@ bool initSD(void)
 		TRACE_ERROR("SD   > No SD card found");
 	} else {
 		TRACE_INFO("SD   > SD card found");
-		sdInitialized = true;
+
+		// Mount SD card
+		FRESULT res = f_mount(&fs, "/", 1);
+		if(res != FR_OK) {
+			TRACE_ERROR("SD   > Mounting failed (err=%d)", res);
+		} else {
+			sdInitialized = true;
+			archiveInit();
+		}
 	}
 	spiReleaseBus(&SPID2);
 
 	return sdInitialized;
 }
 
-bool writeBufferToFile(const char *filename, const uint8_t *buffer, uint32_t len)
+/**
+  * Appends an image to the archive. The record is followed by an empty header
+  * which terminates the chain, the archive wraps around when it is full.
+  */
+bool sdArchiveWrite(uint8_t id, const uint8_t *buffer, uint32_t len)
 {
-	if(!sdInitialized)
+	if(!sdInitialized || !archiveOpen)
+		return false;
+
+	uint32_t reclen = SD_ARCHIVE_RECLEN(len);
+	if(reclen + sizeof(sd_archive_hdr_t) > SD_ARCHIVE_SIZE)
 		return false;
 
 	spiAcquireBus(&SPID2);
 
-	static FATFS fs;
-	static FIL fdst;
+	systime_t start = chVTGetSystemTimeX();
+	sd_archive_hdr_t hdr;
+	ptime_t time;
 	FRESULT res;
-	bool gres = true; // Optimist
-
-	// Mount SD card
-	TRACE_INFO("SD   > Mount");
-	res = f_mount(&fs, "/", 0);
-	if(res != FR_OK)
-	{
-
-		TRACE_ERROR("SD   > Mounting failed (err=%d)", res);
-		gres = false;
-
-	} else {
-
-		// Open file
-		TRACE_INFO("SD   > Open file %s", filename);
-		res = f_open(&fdst, (TCHAR*)filename, FA_CREATE_ALWAYS | FA_WRITE);
-		if(res != FR_OK)
-		{
-
-			TRACE_ERROR("SD   > Opening file failed (err=%d)", res);
-			gres = false;
-
-		} else {
-
-			// Write buffer into file
-			TRACE_INFO("SD   > Write buffer to file (len=%d)", len);
-			uint32_t len_written;
-			f_write(&fdst, buffer, len, (UINT*)&len_written);
-			if(len_written != len)
-			{
-				TRACE_ERROR("SD   > Writing failed (err=%d)", res);
-				gres = false;
-			}
-
-			// Close file
-			TRACE_INFO("SD   > Close file");
-			res = f_close(&fdst);
-			if(res != FR_OK)
-			{
-				TRACE_ERROR("SD   > Closing file failed (err=%d)", res);
-				gres = false;
-			}
-
-		}
-
-		// Unmount
-		TRACE_INFO("SD   > Unmount");
-		res = f_mount(0, "", 0);
-		if(res != FR_OK)
-		{
-			TRACE_ERROR("SD   > Unmounting failed (err=%d)", res);
-			gres = false;
-		}
+	UINT written;
+
+	if(archivePos + reclen + sizeof(hdr) > SD_ARCHIVE_SIZE)
+		archivePos = 0; // Wrap around
+
+	getTime(&time);
+	hdr.magic = SD_ARCHIVE_MAGIC;
+	hdr.time = date2UnixSeconds(time);
+	hdr.len = len;
+	hdr.id = id;
+
+	res = f_lseek(&archive, archivePos);
+	if(res == FR_OK)
+		res = f_write(&archive, &hdr, sizeof(hdr), &written);
+	if(res == FR_OK)
+		res = f_write(&archive, buffer, len, &written);
+	if(res == FR_OK && written == len) {
+		// Terminate chain at the next sector boundary
+		memset(&hdr, 0, sizeof(hdr));
+		res = f_lseek(&archive, archivePos + reclen);
+		if(res == FR_OK)
+			res = f_write(&archive, &hdr, sizeof(hdr), &written);
 	}
+	if(res == FR_OK)
+		res = f_sync(&archive);
 
 	spiReleaseBus(&SPID2);
 
-	return gres;
-}
+	if(res != FR_OK) {
+		TRACE_ERROR("SD   > Archive write failed (err=%d)", res);
+		return false;
+	}
 
+	TRACE_INFO("SD   > Archived image ID=%d at %d (len=%d, %d ms)", id, archivePos, len, ST2MS(chVTGetSystemTimeX() - start));
+	archivePos += reclen;
+	return true;
+}
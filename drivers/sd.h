@@ -4,10 +4,26 @@
 #include "ch.h"
 #include "hal.h"
 
+#define SD_ARCHIVE_FILE		"IMAGES.BIN"		/* Image archive (pre-allocated) */
+#define SD_ARCHIVE_SIZE		(64*1024*1024)		/* Size of image archive */
+#define SD_ARCHIVE_MAGIC	0x30474D49			/* "IMG0" */
+#define SD_ARCHIVE_SECTOR	512
+
+/* Records start on sector boundaries */
+#define SD_ARCHIVE_RECLEN(len)	((sizeof(sd_archive_hdr_t) + (len) + SD_ARCHIVE_SECTOR - 1) & ~(SD_ARCHIVE_SECTOR - 1))
+
+typedef struct {
+	uint32_t	magic;		// SD_ARCHIVE_MAGIC, 0 terminates the chain
+	uint32_t	time;		// Unix timestamp
+	uint32_t	len;		// JPEG size
+	uint8_t		id;			// SSDV image ID
+	uint8_t		reserved[3];
+} sd_archive_hdr_t;
+
 extern MMCDriver MMCD1;
 
 bool initSD(void);
-bool writeBufferToFile(const char *filename, const uint8_t *buffer, uint32_t len);
+bool sdArchiveWrite(uint8_t id, const uint8_t *buffer, uint32_t len);
 
 #endif
 
@@ -71,6 +71,12 @@ bool I2C_read16_locked(uint8_t address, uint8_t reg, uint16_t *val)
 	return ret;
 }
 
+bool I2C_readN_locked(uint8_t address, uint8_t reg, uint8_t *rxbuf, uint32_t length)
+{
+	uint8_t txbuf[] = {reg};
+	return I2C_send(address, txbuf, 1, rxbuf, length, MS2ST(100));
+}
+
 // I2C Mutex unlocked access functions
 
 bool I2C_write8(uint8_t address, uint8_t reg, uint8_t value)
@@ -105,6 +111,14 @@ bool I2C_read16(uint8_t address, uint8_t reg, uint16_t *val)
 	return ret;
 }
 
+bool I2C_readN(uint8_t address, uint8_t reg, uint8_t *rxbuf, uint32_t length)
+{
+	I2C_lock();
+	bool ret = I2C_readN_locked(address, reg, rxbuf, length);
+	I2C_unlock();
+	return ret;
+}
+
 bool I2C_read16_LE(uint8_t address, uint8_t reg, uint16_t *val) {
 	bool ret = I2C_read16_locked(address, reg, val);
 	*val = (*val >> 8) | (*val << 8);
@@ -18,12 +18,14 @@ bool I2C_write8_locked(uint8_t address, uint8_t reg, uint8_t value);
 bool I2C_writeN_locked(uint8_t address, uint8_t *txbuf, uint32_t length);
 bool I2C_read8_locked(uint8_t address, uint8_t reg, uint8_t *val);
 bool I2C_read16_locked(uint8_t address, uint8_t reg, uint16_t *val);
+bool I2C_readN_locked(uint8_t address, uint8_t reg, uint8_t *rxbuf, uint32_t length);
 
 // I2C Mutex unlocked access functions
 bool I2C_write8(uint8_t address, uint8_t reg, uint8_t value);
 bool I2C_writeN(uint8_t address, uint8_t *txbuf, uint32_t length);
 bool I2C_read8(uint8_t address, uint8_t reg, uint8_t *val);
 bool I2C_read16(uint8_t address, uint8_t reg, uint16_t *val);
+bool I2C_readN(uint8_t address, uint8_t reg, uint8_t *rxbuf, uint32_t length);
 bool I2C_read16_LE(uint8_t address, uint8_t reg, uint16_t *val);
 bool I2C_readS16(uint8_t address, uint8_t reg, int16_t *val);
 bool I2C_readS16_LE(uint8_t address, uint8_t reg, int16_t* val);
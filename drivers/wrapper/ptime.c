@@ -34,6 +34,15 @@ uint64_t date2UnixTimestamp(ptime_t time) {
 	return timeC * 1000 + time.millisecond;
 }
 
+/**
+  * Calculates UNIX timestamp in seconds from Julian calendar based format.
+  * @param time Date to be converted
+  * @return UNIX timestamp in seconds
+  */
+uint32_t date2UnixSeconds(ptime_t time) {
+	return date2UnixTimestamp(time) / 1000;
+}
+
 /**
   * Calculates Julian calendar based date/time from UNIX timestamp.
   * Calculation valid until 2100 due to missing leapyear in 2100.
@@ -15,6 +15,7 @@ typedef struct {
 } ptime_t;
 
 uint64_t date2UnixTimestamp(ptime_t time);
+uint32_t date2UnixSeconds(ptime_t time);
 ptime_t unixTimestamp2Date(uint64_t time);
 void getTime(ptime_t *date);
 void setTime(ptime_t date);
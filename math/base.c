@@ -32,10 +32,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "ch.h"
-#include "hal.h"
 #include "base.h"
-#include "debug.h"
 
 static char b64_table[] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
                                 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
@@ -47,6 +44,26 @@ static char b64_table[] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
                                 '4', '5', '6', '7', '8', '9', '+', '/'};
 static int b64_mod_table[] = {0, 2, 1};
 
+/* Base64 character to value, 64 = not in the alphabet */
+static const uint8_t b64_dectab[256] = {
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 64, 64, 63,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
+	64,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 64,
+	64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+};
+
 const unsigned char b91_table[91] = {
 	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
 	'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
@@ -57,11 +74,25 @@ const unsigned char b91_table[91] = {
 	'>', '?', '@', '[', ']', '^', '_', '`', '{', '|', '}', '~', '"'
 };
 
-typedef struct {
-	uint64_t queue;
-	uint64_t nbits;
-	uint32_t val;
-} base91_t;
+/* Base91 character to value, 91 = not in the alphabet */
+static const uint8_t b91_dectab[256] = {
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 62, 90, 63, 64, 65, 66, 91, 67, 68, 69, 70, 71, 91, 72, 73,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 74, 75, 76, 77, 78, 79,
+	80,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 81, 91, 82, 83, 84,
+	85, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 86, 87, 88, 89, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+};
 
 void base64_encode(const uint8_t *in, uint8_t *out, uint16_t input_length) {
 	uint32_t i,j;
@@ -84,8 +115,39 @@ void base64_encode(const uint8_t *in, uint8_t *out, uint16_t input_length) {
 	out[BASE64LEN(input_length)] = '\0';
 }
 
+/**
+ * Decodes Base64, characters not in the alphabet (padding, line breaks)
+ * are skipped. Returns the number of bytes written to out.
+ */
+size_t base64_decode(const uint8_t *in, uint8_t *out, size_t input_length) {
+	uint32_t quad = 0;
+	uint8_t nchar = 0, d;
+	size_t n = 0;
+
+	while(input_length--) {
+		d = b64_dectab[*in++];
+		if(d == 64)
+			continue;
+		quad = (quad << 6) | d;
+		if(++nchar == 4) {
+			out[n++] = quad >> 16;
+			out[n++] = quad >> 8;
+			out[n++] = quad;
+			quad = 0;
+			nchar = 0;
+		}
+	}
 
+	// 2 or 3 characters left hold 1 or 2 bytes
+	if(nchar == 2) {
+		out[n++] = quad >> 4;
+	} else if(nchar == 3) {
+		out[n++] = quad >> 10;
+		out[n++] = quad >> 2;
+	}
 
+	return n;
+}
 
 void basE91_init(base91_t *b)
 {
@@ -94,30 +156,48 @@ void basE91_init(base91_t *b)
 	b->val = -1;
 }
 
+/**
+ * Encodes one byte, writes 0 to 2 characters to out and returns their
+ * number. Used to stream Base91 without an output buffer. The queue never
+ * holds more than 21 bits, so 32 bit arithmetic is sufficient.
+ */
+uint8_t basE91_encode_byte(base91_t *b, uint8_t in, uint8_t *out)
+{
+	uint32_t queue = b->queue | ((uint32_t)in << b->nbits);
+	uint32_t nbits = b->nbits + 8;
+	uint32_t val;
+
+	if (nbits <= 13) {	/* not enough bits in queue */
+		b->queue = queue;
+		b->nbits = nbits;
+		return 0;
+	}
+
+	val = queue & 8191;
+	if (val > 88) {
+		queue >>= 13;
+		nbits -= 13;
+	} else {	/* we can take 14 bits */
+		val = queue & 16383;
+		queue >>= 14;
+		nbits -= 14;
+	}
+	b->queue = queue;
+	b->nbits = nbits;
+
+	out[0] = b91_table[val % 91];
+	out[1] = b91_table[val / 91];
+	return 2;
+}
+
 size_t basE91_encode(base91_t *b, const void *i, size_t len, void *o)
 {
 	const uint8_t *ib = i;
 	uint8_t *ob = o;
 	size_t n = 0;
 
-	while (len--) {
-		b->queue |= *ib++ << b->nbits;
-		b->nbits += 8;
-		if (b->nbits > 13) {	/* enough bits in queue */
-			uint32_t val = b->queue & 8191;
-
-			if (val > 88) {
-				b->queue >>= 13;
-				b->nbits -= 13;
-			} else {	/* we can take 14 bits */
-				val = b->queue & 16383;
-				b->queue >>= 14;
-				b->nbits -= 14;
-			}
-			ob[n++] = b91_table[val % 91];
-			ob[n++] = b91_table[val / 91];
-		}
-	}
+	while (len--)
+		n += basE91_encode_byte(b, *ib++, &ob[n]);
 
 	return n;
 }
@@ -139,23 +219,82 @@ size_t basE91_encode_end(base91_t *b, void *o)
 	return n;
 }
 
-void base91_encode(const uint8_t *in, uint8_t *out, uint16_t input_length) {
-	base91_t handle;
+/**
+ * Decodes Base91, characters not in the alphabet are skipped. Two
+ * characters give 13 or 14 bits, the queue never holds more than 21.
+ */
+size_t basE91_decode(base91_t *b, const void *i, size_t len, void *o)
+{
+	const uint8_t *ib = i;
+	uint8_t *ob = o;
+	size_t n = 0;
+	uint32_t d;
 
-	uint32_t ototal = 0;
-	for(uint32_t i=0; i<(uint32_t)BASE91LEN(input_length); i++)
-		out[i] = 0;
+	while (len--) {
+		d = b91_dectab[*ib++];
+		if (d == 91)
+			continue;	/* ignore non-alphabet chars */
+		if (b->val == -1) {
+			b->val = d;	/* start next value */
+		} else {
+			b->val += d * 91;
+			b->queue |= (uint32_t)b->val << b->nbits;
+			b->nbits += (b->val & 8191) > 88 ? 13 : 14;
+			do {
+				ob[n++] = b->queue;
+				b->queue >>= 8;
+				b->nbits -= 8;
+			} while (b->nbits > 7);
+			b->val = -1;	/* mark value complete */
+		}
+	}
 
-	basE91_init(&handle);
-	ototal += basE91_encode(&handle, in, input_length, out);
-	ototal += basE91_encode_end(&handle, out + ototal);
+	return n;
 }
 
+size_t basE91_decode_end(base91_t *b, void *o)
+{
+	uint8_t *ob = o;
+	size_t n = 0;
+
+	if (b->val != -1)
+		ob[n++] = b->queue | (uint32_t)b->val << b->nbits;
+	b->queue = 0;
+	b->nbits = 0;
+	b->val = -1;
 
+	return n;
+}
 
+/**
+ * Encodes a whole buffer, returns the number of characters written to out.
+ * out (BASE91LEN(input_length) bytes) is zero filled first, so the result
+ * is terminated if it is shorter than BASE91LEN.
+ */
+size_t base91_encode(const uint8_t *in, uint8_t *out, uint16_t input_length) {
+	base91_t handle;
+	size_t n;
 
+	for(uint32_t i=0; i<(uint32_t)BASE91LEN(input_length); i++)
+		out[i] = 0;
 
+	basE91_init(&handle);
+	n = basE91_encode(&handle, in, input_length, out);
+	n += basE91_encode_end(&handle, out + n);
 
+	return n;
+}
 
+/**
+ * Decodes a whole buffer, returns the number of bytes written to out
+ */
+size_t base91_decode(const uint8_t *in, uint8_t *out, size_t input_length) {
+	base91_t handle;
+	size_t n;
 
+	basE91_init(&handle);
+	n = basE91_decode(&handle, in, input_length, out);
+	n += basE91_decode_end(&handle, out + n);
 
+	return n;
+}
@@ -1,14 +1,28 @@
 #ifndef __BASE_H__
 #define __BASE_H__
 
-#include "ch.h"
-#include "hal.h"
-#include <math.h>
+#include <stdint.h>
+#include <stddef.h>
 
 #define BASE64LEN(in) (4 * (((in) + 2) / 3))
 #define BASE91LEN(in) ((((in)*16)+26) / 13)
 
+typedef struct {
+	uint32_t queue;
+	uint32_t nbits;
+	int32_t val;
+} base91_t;
+
+void basE91_init(base91_t *b);
+uint8_t basE91_encode_byte(base91_t *b, uint8_t in, uint8_t *out);
+size_t basE91_encode(base91_t *b, const void *i, size_t len, void *o);
+size_t basE91_encode_end(base91_t *b, void *o);
+size_t basE91_decode(base91_t *b, const void *i, size_t len, void *o);
+size_t basE91_decode_end(base91_t *b, void *o);
+
 void base64_encode(const uint8_t *in, uint8_t *out, uint16_t input_length);
-void base91_encode(const uint8_t *in, uint8_t *out, uint16_t input_length);
+size_t base64_decode(const uint8_t *in, uint8_t *out, size_t input_length);
+size_t base91_encode(const uint8_t *in, uint8_t *out, uint16_t input_length);
+size_t base91_decode(const uint8_t *in, uint8_t *out, size_t input_length);
 
 #endif
@@ -0,0 +1,134 @@
+/**
+ * CRC32 (IEEE 802.3, reflected) for SSDV packets.
+ *
+ * The STM32F4 CRC unit calculates the same polynomial but MSB first on
+ * 32 bit words, with no final XOR. Bit-reversing each input word and the
+ * result gives the reflected CRC. Bytes which don't fill a whole word are
+ * processed in software, continuing from the state of the CRC unit.
+ */
+#if defined(__arm__)
+#include "ch.h"
+#include "hal.h"
+#include "debug.h"
+#endif
+#include "crc32.h"
+
+#define CRC32_POLY 0xEDB88320
+
+/* Reflected CRC register over one byte, bit by bit */
+static inline uint32_t crc32_byte(uint32_t crc, uint8_t b)
+{
+	uint32_t x = (crc ^ b) & 0xFF;
+	uint8_t i;
+
+	for(i = 8; i > 0; i--)
+	{
+		if(x & 1) x = (x >> 1) ^ CRC32_POLY;
+		else x >>= 1;
+	}
+	return (crc >> 8) ^ x;
+}
+
+uint32_t crc32_ref(const void *data, size_t length)
+{
+	const uint8_t *d = data;
+	uint32_t crc = 0xFFFFFFFF;
+
+	for(; length; length--)
+		crc = crc32_byte(crc, *(d++));
+
+	return crc ^ 0xFFFFFFFF;
+}
+
+#if defined(STM32F4XX)
+
+static MUTEX_DECL(crc32_mtx);
+static int8_t crc32_hw_ok; // 0 = not tested yet, 1 = CRC unit works, -1 = use software
+
+static uint32_t crc32_hw(const uint8_t *d, size_t length)
+{
+	uint32_t crc;
+
+	CRC->CR = CRC_CR_RESET;
+	for(; length >= 4; length -= 4, d += 4)
+		CRC->DR = __RBIT(d[0] | (d[1] << 8) | (d[2] << 16) | ((uint32_t)d[3] << 24));
+	crc = __RBIT(CRC->DR);
+
+	for(; length; length--)
+		crc = crc32_byte(crc, *(d++));
+
+	return crc ^ 0xFFFFFFFF;
+}
+
+uint32_t crc32(const void *data, size_t length)
+{
+	static const uint8_t check[] = "123456789 SSDV"; // Covers whole words and a tail
+	uint32_t crc;
+
+	chMtxLock(&crc32_mtx);
+
+	if(!crc32_hw_ok)
+	{
+		rccEnableAHB1(RCC_AHB1ENR_CRCEN, FALSE);
+		if(crc32_hw(check, sizeof(check)-1) == crc32_ref(check, sizeof(check)-1)) {
+			crc32_hw_ok = 1;
+		} else {
+			TRACE_ERROR("CRC  > CRC unit doesn't match reference, use software");
+			crc32_hw_ok = -1;
+		}
+	}
+
+	if(crc32_hw_ok > 0)
+		crc = crc32_hw(data, length);
+	else
+		crc = crc32_ref(data, length);
+
+	chMtxUnlock(&crc32_mtx);
+
+	return crc;
+}
+
+#else /* Host */
+
+static uint32_t crc32_table[8][256];
+static uint8_t crc32_table_ok;
+
+static void crc32_init_table(void)
+{
+	uint32_t i, j;
+
+	for(i = 0; i < 256; i++)
+		crc32_table[0][i] = crc32_byte(0, i);
+	for(i = 0; i < 256; i++)
+		for(j = 1; j < 8; j++)
+			crc32_table[j][i] = (crc32_table[j-1][i] >> 8) ^ crc32_table[0][crc32_table[j-1][i] & 0xFF];
+
+	crc32_table_ok = 1;
+}
+
+uint32_t crc32(const void *data, size_t length)
+{
+	const uint8_t *d = data;
+	uint32_t crc = 0xFFFFFFFF, a, b;
+
+	if(!crc32_table_ok)
+		crc32_init_table();
+
+	/* Slice-by-8, eight bytes per step */
+	for(; length >= 8; length -= 8, d += 8)
+	{
+		a = crc ^ (d[0] | (d[1] << 8) | (d[2] << 16) | ((uint32_t)d[3] << 24));
+		b = d[4] | (d[5] << 8) | (d[6] << 16) | ((uint32_t)d[7] << 24);
+		crc = crc32_table[7][a & 0xFF] ^ crc32_table[6][(a >> 8) & 0xFF]
+		    ^ crc32_table[5][(a >> 16) & 0xFF] ^ crc32_table[4][a >> 24]
+		    ^ crc32_table[3][b & 0xFF] ^ crc32_table[2][(b >> 8) & 0xFF]
+		    ^ crc32_table[1][(b >> 16) & 0xFF] ^ crc32_table[0][b >> 24];
+	}
+
+	for(; length; length--)
+		crc = (crc >> 8) ^ crc32_table[0][(crc ^ *(d++)) & 0xFF];
+
+	return crc ^ 0xFFFFFFFF;
+}
+
+#endif
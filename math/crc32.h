@@ -0,0 +1,15 @@
+#ifndef __CRC32_H__
+#define __CRC32_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * CRC32 as used by SSDV (reflected, polynomial 0xEDB88320, init and final
+ * XOR 0xFFFFFFFF). On the STM32F4 the CRC unit is used, on a PC a
+ * slice-by-8 table. crc32_ref() is the bitwise reference for both.
+ */
+uint32_t crc32(const void *data, size_t length);
+uint32_t crc32_ref(const void *data, size_t length);
+
+#endif
@@ -0,0 +1,141 @@
+/**
+  * Fixed point alpha-beta filter for the balloon position. GPS fixes update
+  * latitude, longitude and altitude, the barometric altitude keeps the
+  * altitude and vertical rate running between fixes. The GPS altitude
+  * calibrates the barometric altitude, which has an offset due to the
+  * unknown sea level pressure. When a fix is missed, the position is
+  * extrapolated with the estimated velocities.
+  */
+
+#include "filter.h"
+#include <string.h>
+
+#define DEG360	3600000000LL	/* 360 deg in deg*10^7 */
+
+static int32_t wrapLon(int64_t lon)
+{
+	while(lon > DEG360/2)
+		lon -= DEG360;
+	while(lon < -DEG360/2)
+		lon += DEG360;
+	return lon;
+}
+
+static int32_t clamp(int64_t val, int32_t limit)
+{
+	if(val > limit)
+		return limit;
+	if(val < -limit)
+		return -limit;
+	return val;
+}
+
+static int64_t predictAxis(const filterAxis_t *a, uint32_t dt)
+{
+	return a->pos + (((int64_t)a->vel * dt) >> FILTER_VEL_SHIFT);
+}
+
+/**
+  * Updates an axis by a measurement dt seconds after its state. Returns the
+  * deviation of the measurement from the prediction.
+  */
+static int64_t updateAxis(filterAxis_t *a, uint32_t dt, int64_t z, int32_t alpha, int32_t beta, int32_t vmax, bool wrap)
+{
+	int64_t p = predictAxis(a, dt);
+	int64_t r = z - p;
+	if(wrap)
+		r = wrapLon(r);
+
+	p += (alpha * r) >> FILTER_GAIN_SHIFT;
+	a->pos = wrap ? wrapLon(p) : p;
+	if(dt)
+		a->vel = clamp(a->vel + ((beta * r) << FILTER_VEL_SHIFT >> FILTER_GAIN_SHIFT) / dt, vmax << FILTER_VEL_SHIFT);
+
+	return r;
+}
+
+/**
+  * Time in s from since to time, limited to FILTER_MAX_PREDICT
+  */
+static uint32_t elapsed(uint32_t since, uint32_t time)
+{
+	if(time <= since)
+		return 0;
+	return time - since < FILTER_MAX_PREDICT ? time - since : FILTER_MAX_PREDICT;
+}
+
+void filterInit(posFilter_t *f)
+{
+	memset(f, 0, sizeof(posFilter_t));
+}
+
+/**
+  * Updates the filter by a GPS fix. lat/lon in deg*10^7, alt in m. baro is
+  * the barometric altitude in cm sampled with the fix (if baro_valid).
+  */
+void filterGPS(posFilter_t *f, uint32_t time, int32_t lat, int32_t lon, int32_t alt, bool baro_valid, int32_t baro)
+{
+	int32_t alt_cm = alt * 100;
+
+	if(!f->initialized || time < f->time || time - f->fix_time > FILTER_RESET_TIME) { // (Re)start
+		filterInit(f);
+		f->initialized = true;
+		f->lat.pos = lat;
+		f->lon.pos = lon;
+		f->alt.pos = alt_cm;
+	} else {
+		uint32_t dt = elapsed(f->fix_time, time);
+		int64_t rlat = updateAxis(&f->lat, dt, lat, FILTER_GPS_ALPHA, FILTER_GPS_BETA, FILTER_MAX_HVEL, false);
+		int64_t rlon = updateAxis(&f->lon, dt, lon, FILTER_GPS_ALPHA, FILTER_GPS_BETA, FILTER_MAX_HVEL, true);
+		updateAxis(&f->alt, elapsed(f->time, time), alt_cm, FILTER_GPS_ALPHA, FILTER_GPS_BETA, FILTER_MAX_VVEL, false);
+
+		// Deviation in m, 1e-7 deg = 1.1cm (longitude overestimated off the equator)
+		int64_t r = (rlat < 0 ? -rlat : rlat) > (rlon < 0 ? -rlon : rlon) ? rlat : rlon;
+		uint32_t dev = (r < 0 ? -r : r) * 111 / 10000;
+		f->error += ((int32_t)dev - (int32_t)f->error) / 4;
+	}
+
+	if(baro_valid) { // Calibrate barometric altitude
+		int32_t offset = alt_cm - baro;
+		if(f->baro_valid)
+			f->baro_offset += (offset - f->baro_offset) / FILTER_BARO_OFFSET;
+		else
+			f->baro_offset = offset;
+		f->baro_valid = true;
+	}
+
+	f->time = time;
+	f->fix_time = time;
+}
+
+/**
+  * Updates altitude and vertical rate by the barometric altitude in cm
+  * (e.g. BME280_getAltitude) while there is no GPS fix. Latitude and
+  * longitude stay at the last fix, they are extrapolated by filterPredict.
+  */
+void filterBaro(posFilter_t *f, uint32_t time, int32_t baro)
+{
+	if(!f->initialized || !f->baro_valid || time < f->time)
+		return;
+
+	updateAxis(&f->alt, elapsed(f->time, time), (int64_t)baro + f->baro_offset, FILTER_BARO_ALPHA, FILTER_BARO_BETA, FILTER_MAX_VVEL, false);
+	f->time = time;
+}
+
+/**
+  * Extrapolates the position to time. lat/lon in deg*10^7, alt in m.
+  * lat/lon are extrapolated at most FILTER_MAX_PREDICT after the last fix.
+  * Returns false if there is no estimate.
+  */
+bool filterPredict(const posFilter_t *f, uint32_t time, int32_t *lat, int32_t *lon, int32_t *alt)
+{
+	if(!f->initialized)
+		return false;
+
+	uint32_t dt = elapsed(f->fix_time, time);
+	int64_t p = predictAxis(&f->lat, dt);
+	*lat = clamp(p, 900000000);
+	*lon = wrapLon(predictAxis(&f->lon, dt));
+	*alt = predictAxis(&f->alt, elapsed(f->time, time)) / 100;
+	return true;
+}
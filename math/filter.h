@@ -0,0 +1,43 @@
+#ifndef __FILTER_H__
+#define __FILTER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FILTER_GAIN_SHIFT	8			/* Gains are in 1/256 */
+#define FILTER_VEL_SHIFT	8			/* Velocities are in units/s * 256 */
+
+#define FILTER_GPS_ALPHA	205			/* Position gain of GPS fixes (0.8) */
+#define FILTER_GPS_BETA		51			/* Velocity gain of GPS fixes (0.2) */
+#define FILTER_BARO_ALPHA	128			/* Altitude gain of barometric altitude (0.5) */
+#define FILTER_BARO_BETA	26			/* Vertical rate gain of barometric altitude (0.1) */
+#define FILTER_BARO_OFFSET	4			/* Weight of the GPS/baro offset average, new offset counts 1/n */
+
+#define FILTER_MAX_HVEL		20000		/* Max. horizontal velocity in deg*10^7/s (about 220m/s) */
+#define FILTER_MAX_VVEL		10000		/* Max. vertical rate in cm/s */
+#define FILTER_MAX_PREDICT	900			/* Max. time in s a position is extrapolated */
+#define FILTER_RESET_TIME	3600		/* Time in s without GPS fix after which the filter restarts */
+
+typedef struct {
+	int32_t pos;			// Position
+	int32_t vel;			// Velocity in units/s * 2^FILTER_VEL_SHIFT
+} filterAxis_t;
+
+typedef struct {
+	bool initialized;		// At least one GPS fix
+	uint32_t time;			// Time of the altitude state (UNIX timestamp)
+	uint32_t fix_time;		// Time of the last GPS fix and the lat/lon state (UNIX timestamp)
+	filterAxis_t lat;		// Latitude in deg*10^7
+	filterAxis_t lon;		// Longitude in deg*10^7
+	filterAxis_t alt;		// Altitude in cm
+	bool baro_valid;		// Barometric offset known
+	int32_t baro_offset;	// GPS altitude - barometric altitude in cm
+	uint32_t error;			// Average horizontal deviation of GPS fixes from the prediction in m
+} posFilter_t;
+
+void filterInit(posFilter_t *f);
+void filterGPS(posFilter_t *f, uint32_t time, int32_t lat, int32_t lon, int32_t alt, bool baro_valid, int32_t baro);
+void filterBaro(posFilter_t *f, uint32_t time, int32_t baro);
+bool filterPredict(const posFilter_t *f, uint32_t time, int32_t *lat, int32_t *lon, int32_t *alt);
+
+#endif
@@ -30,7 +30,6 @@
 
 #include "debug.h"
 #include "modules.h"
-#include "base.h"
 #include "aprs.h"
 
 // File encoding table
@@ -80,7 +79,6 @@ void log_error(char *file, uint16_t line)
 }
 
 static uint32_t pkt[ERRORLOG_SIZE+1];
-static uint8_t pkt_base91[BASE91LEN(4*ERRORLOG_SIZE+4)];
 
 THD_FUNCTION(moduleERROR, arg)
 {
@@ -129,12 +127,7 @@ THD_FUNCTION(moduleERROR, arg)
 					msg.afsk_config = &(config->afsk_config);
 					msg.gfsk_config = &(config->gfsk_config);
 
-					// Deleting buffer
-					for(uint8_t t=0; t<sizeof(pkt_base91); t++)
-						pkt_base91[t] = 0;
-
-					base91_encode((uint8_t*)pkt, pkt_base91, 4*size+4);
-					msg.bin_len = aprs_encode_experimental('E', msg.msg, msg.mod, &config->aprs_config, pkt_base91, strlen((char*)pkt_base91));
+					msg.bin_len = aprs_encode_experimental('E', msg.msg, msg.mod, &config->aprs_config, (uint8_t*)pkt, 4*size+4);
 
 					transmitOnRadio(&msg);
 					break;
@@ -8,20 +8,237 @@
 #include "ssdv.h"
 #include "aprs.h"
 #include "radio.h"
-#include "base.h"
 #include <string.h>
 #include "types.h"
 #include "sleep.h"
 #include "sd.h"
+#include <math.h>
 
 static uint32_t gimage_id;
 mutex_t camera_mtx;
 
+/*
+ * JPEG size predictor for RES_MAX. It keeps an average of the image sizes
+ * per resolution and quality. Combinations that haven't been captured yet
+ * are estimated from the pixel count, scaled by a correction factor learnt
+ * from all captures. The scene brightness (YAVG) of the last capture
+ * scales the prediction, because bright scenes have more detail than dark
+ * ones.
+ */
+#define PRED_EMA_SHIFT		2	// New samples weigh 1/4
+#define PRED_QUALITY_STEPS	3	// Quality may be reduced by this many levels before the resolution
+#define PRED_MAX_ATTEMPTS	4	// Max. captures per image
+#define PRED_MARGIN(x)		((x) + (x)/4) // Headroom on top of the prediction
+
+static const uint32_t pred_pixels[RES_MAX] = {
+	[RES_QCIF]	= 176*144,
+	[RES_QVGA]	= 320*240,
+	[RES_VGA]	= 640*480,
+	[RES_XGA]	= 1024*768,
+	[RES_UXGA]	= 1600*1200
+};
+static const uint16_t pred_bpp[OV2640_QUALITY_MAX] = { // Estimated bytes per 1024 pixels at each quality
+	40, 50, 65, 85, 110, 130, 160, 200
+};
+
+static uint32_t pred_size[RES_MAX][OV2640_QUALITY_MAX]; // Average JPEG size (0 = no capture yet)
+static uint8_t pred_yavg[RES_MAX][OV2640_QUALITY_MAX]; // Brightness at those captures
+static uint32_t pred_scale = 256; // Measured/estimated size ratio (8.8 fixed point)
+static uint8_t pred_last_yavg; // Brightness of last capture (0 = unknown)
+
+static uint32_t predictEstimate(resolution_t res, uint8_t quality)
+{
+	return (uint64_t)pred_pixels[res] * pred_bpp[quality-1] / 1024;
+}
+
+static uint32_t predictSize(resolution_t res, uint8_t quality)
+{
+	uint32_t size = pred_size[res][quality-1];
+	uint8_t yavg = pred_yavg[res][quality-1];
+
+	if(!size) // Unknown, use the corrected estimate
+		return (uint64_t)predictEstimate(res, quality) * pred_scale / 256;
+
+	// Scale by brightness change (limited to 1/2..2)
+	if(pred_last_yavg && yavg) {
+		uint32_t num = pred_last_yavg + 64;
+		uint32_t den = yavg + 64;
+		if(num > 2*den)
+			num = 2*den;
+		if(2*num < den)
+			num = den/2;
+		size = (uint64_t)size * num / den;
+	}
+	return size;
+}
+
+/**
+  * Feeds the size of a capture into the predictor. On overflow only a lower
+  * limit is known, which is raised by the margin to move away from this
+  * combination.
+  */
+static void predictUpdate(resolution_t res, uint8_t quality, uint32_t size, bool overflow, uint8_t yavg)
+{
+	uint32_t *avg = &pred_size[res][quality-1];
+
+	if(overflow) {
+		size = PRED_MARGIN(size);
+		if(*avg < size)
+			*avg = size;
+	} else {
+		*avg = *avg ? *avg - (*avg >> PRED_EMA_SHIFT) + (size >> PRED_EMA_SHIFT) : size;
+
+		// Learn the correction factor for unknown combinations
+		uint32_t ratio = (uint64_t)size * 256 / predictEstimate(res, quality);
+		pred_scale = pred_scale - (pred_scale >> PRED_EMA_SHIFT) + (ratio >> PRED_EMA_SHIFT);
+	}
+
+	if(yavg) {
+		pred_yavg[res][quality-1] = yavg;
+		pred_last_yavg = yavg;
+	}
+}
+
+/**
+  * Selects the largest resolution (and the highest quality at it) which
+  * is likely to fit into the buffer. Quality is reduced before resolution.
+  */
+static void predictSelect(size_t ram_size, uint8_t max_quality, resolution_t *res, uint8_t *quality)
+{
+	uint8_t min_quality = max_quality > OV2640_QUALITY_MIN + PRED_QUALITY_STEPS ? max_quality - PRED_QUALITY_STEPS : OV2640_QUALITY_MIN;
+
+	for(int32_t r=RES_UXGA; r>=RES_QVGA; r--) {
+		for(uint8_t q=max_quality; q>=min_quality; q--) {
+			uint32_t size = predictSize(r, q);
+			if(PRED_MARGIN(size) <= ram_size) {
+				TRACE_INFO("IMG  > Predicted %d bytes for resolution %d quality %d", size, r, q);
+				*res = r;
+				*quality = q;
+				return;
+			}
+		}
+	}
+
+	TRACE_WARN("IMG  > No resolution predicted to fit into %d bytes", ram_size);
+	*res = RES_QVGA;
+	*quality = min_quality;
+}
+
+/*
+ * Camera buffer pool. Buffers are reference counted, so an image can be
+ * transmitted by several modules while the next one is captured into
+ * another buffer. The pool keeps a reference to the latest image for
+ * modules without camera. That buffer is reused if nothing else is free.
+ */
+static img_buffer_t img_pool[IMG_POOL_BUFFERS];
+static uint32_t img_pool_cnt;
+static img_buffer_t *img_latest;
+static MUTEX_DECL(img_pool_mtx);
+static BSEMAPHORE_DECL(img_pool_bsem, true); // Signalled when a buffer becomes free
+
+/**
+  * Adds a buffer to the pool (only during initialization)
+  */
+void imgPoolAdd(uint8_t *data, size_t size)
+{
+	if(img_pool_cnt >= IMG_POOL_BUFFERS) {
+		TRACE_ERROR("IMG  > Camera buffer pool full");
+		return;
+	}
+
+	img_pool[img_pool_cnt].data = data;
+	img_pool[img_pool_cnt].size = size;
+	img_pool[img_pool_cnt].refs = 0;
+	img_pool_cnt++;
+}
+
+static img_buffer_t* imgBufferFind(size_t size)
+{
+	img_buffer_t *best = NULL;
+	img_buffer_t *largest = NULL;
+
+	for(uint32_t i=0; i<img_pool_cnt; i++) {
+		img_buffer_t *buf = &img_pool[i];
+		if(buf->refs)
+			continue;
+		if(!largest || buf->size > largest->size)
+			largest = buf;
+		if(size && buf->size >= size && (!best || buf->size < best->size))
+			best = buf;
+	}
+	return best ? best : largest;
+}
+
+/**
+  * Takes a free buffer from the pool, the smallest one which holds size
+  * bytes. The largest free buffer is taken if none is large enough or
+  * size is 0. Returns NULL if no buffer got free within timeout.
+  */
+img_buffer_t* imgBufferAcquire(size_t size, systime_t timeout)
+{
+	img_buffer_t *buf;
+
+	while(true)
+	{
+		chMtxLock(&img_pool_mtx);
+		if((buf = imgBufferFind(size)) == NULL && img_latest && img_latest->refs == 1) {
+			// Nothing free, drop the latest image if nobody is using it
+			img_latest->refs = 0;
+			img_latest = NULL;
+			buf = imgBufferFind(size);
+		}
+		if(buf) {
+			buf->refs = 1;
+			buf->len = 0;
+		}
+		chMtxUnlock(&img_pool_mtx);
+
+		if(buf || chBSemWaitTimeout(&img_pool_bsem, timeout) == MSG_TIMEOUT)
+			return buf;
+	}
+}
+
+void imgBufferRelease(img_buffer_t *buf)
+{
+	chMtxLock(&img_pool_mtx);
+	if(--buf->refs == 0)
+		chBSemSignal(&img_pool_bsem);
+	chMtxUnlock(&img_pool_mtx);
+}
+
+/**
+  * Makes a captured image the latest one, which is handed out to modules
+  * without camera
+  */
+void imgBufferPublish(img_buffer_t *buf)
+{
+	chMtxLock(&img_pool_mtx);
+	buf->refs++;
+	if(img_latest && --img_latest->refs == 0)
+		chBSemSignal(&img_pool_bsem);
+	img_latest = buf;
+	chMtxUnlock(&img_pool_mtx);
+}
+
+/**
+  * Returns a reference to the latest image or NULL if there is none
+  */
+img_buffer_t* imgBufferLatest(void)
+{
+	img_buffer_t *buf;
+
+	chMtxLock(&img_pool_mtx);
+	if((buf = img_latest) != NULL)
+		buf->refs++;
+	chMtxUnlock(&img_pool_mtx);
+
+	return buf;
+}
+
 void encode_ssdv(uint8_t *image, uint32_t image_len, module_conf_t* config, uint8_t image_id)
 {
 	ssdv_t ssdv;
 	uint8_t pkt[SSDV_PKT_SIZE];
-	uint8_t pkt_base91[BASE91LEN(SSDV_PKT_SIZE-37)];
 	uint16_t i = 0;
 	uint8_t *b;
 	uint32_t bi = 0;
@@ -70,12 +287,8 @@ void encode_ssdv(uint8_t *image, uint32_t image_len, module_conf_t* config, uint
 				msg.afsk_config = &(config->afsk_config);
 				msg.gfsk_config = &(config->gfsk_config);
 
-				// Deleting buffer
-				for(uint16_t t=0; t<256; t++)
-					pkt_base91[t] = 0;
-
-				base91_encode(&pkt[1], pkt_base91, sizeof(pkt)-37); // Sync byte, CRC and FEC of SSDV not transmitted
-				msg.bin_len = aprs_encode_experimental('I', msg.msg, msg.mod, &config->aprs_config, pkt_base91, strlen((char*)pkt_base91));
+				// Sync byte, CRC and FEC of SSDV not transmitted
+				msg.bin_len = aprs_encode_experimental('I', msg.msg, msg.mod, &config->aprs_config, &pkt[1], sizeof(pkt)-37);
 
 				transmitOnRadio(&msg);
 				break;
@@ -104,130 +317,415 @@ void encode_ssdv(uint8_t *image, uint32_t image_len, module_conf_t* config, uint
 	TRACE_INFO("SSDV > %i packets", i);
 }
 
-THD_FUNCTION(moduleIMG, arg) {
-	module_conf_t* config = (module_conf_t*)arg;
-
-	// Execute Initial delay
-	if(config->init_delay)
-		chThdSleepMilliseconds(config->init_delay);
+/*
+ * Frame selection. Frames are scored by the statistics the SSDV encoder
+ * gathers from the JPEG (no decoding), so black sky, sun glare or a
+ * blurred frame of the spinning payload loses against a detailed one.
+ */
+#define SCORE_DARK			24	// Mean luma below which a frame is too dark
+#define SCORE_BRIGHT		232	// Mean luma above which a frame is overexposed
+#define SCORE_SPACING		500	// Time in ms between the frames to select from
+#define SCORE_MIN			16	// Thumbnails scoring below cancel their full image
+
+/**
+  * Scores a JPEG by its detail (entropy coded bits per MCU), the share of
+  * MCU rows which aren't flat, the luma deviation (contrast) and its
+  * exposure. Returns 0 if the image can't be parsed.
+  */
+static uint32_t imgScore(img_buffer_t *buf, char *callsign)
+{
+	ssdv_t ssdv;
+	ssdv_stats_t stats;
+	uint8_t pkt[SSDV_PKT_SIZE];
+	char c;
 
-	// Print initialization message
-	TRACE_INFO("IMG  > Startup module %s", config->name);
+	ssdv_enc_init(&ssdv, SSDV_TYPE_NOFEC, callsign, 0);
+	ssdv_enc_set_buffer(&ssdv, pkt);
+	ssdv_enc_set_stats(&ssdv, &stats);
+	ssdv_enc_feed(&ssdv, buf->data, buf->len);
+
+	while((c = ssdv_enc_get_packet(&ssdv)) == SSDV_OK); // Packets are dropped
+	if(c != SSDV_EOI || !stats.blocks || !stats.rows)
+		return 0;
+
+	int32_t dc_mean = stats.dc_sum / (int32_t)stats.blocks;
+	int64_t dc_var = (int64_t)(stats.dc_sqsum / stats.blocks) - (int64_t)dc_mean * dc_mean;
+
+	int32_t mean = 128 + dc_mean / 8; // Luma 0..255
+	uint32_t dev = dc_var > 0 ? sqrtf(dc_var) / 8 : 0;
+	uint32_t detail = stats.bits / ssdv.mcu_count;
+	uint32_t coverage = 256 * (stats.rows - stats.flat_rows) / stats.rows;
+	uint32_t exposure = 256;
+	if(mean < SCORE_DARK)
+		exposure = mean > 0 ? 256 * mean / SCORE_DARK : 0;
+	else if(mean > SCORE_BRIGHT)
+		exposure = mean < 255 ? 256 * (255 - mean) / (255 - SCORE_BRIGHT) : 0;
+
+	uint32_t score = (detail + 4*dev) * coverage / 256 * exposure / 256;
+
+	TRACE_INFO("IMG  > Score %d (detail %d bit/MCU, %d/%d flat rows, luma %d +/- %d)",
+		score, detail, stats.flat_rows, stats.rows, mean, dev);
+	return score;
+}
 
-	systime_t time = chVTGetSystemTimeX();
-	while(true)
+/**
+  * Captures an image into a camera buffer. If several frames are
+  * configured and a second buffer is free, the frames are captured in
+  * turns into both buffers and the best one is kept. A thumbnail of the
+  * same scene is captured into thumb (if not NULL) right afterwards, it
+  * gets the image ID ahead of the full image. Returns true if an image has
+  * been sampled, *bufp holds it then.
+  */
+static bool imgCapture(module_conf_t *config, img_buffer_t **bufp, img_buffer_t *thumb)
+{
+	uint8_t tries;
+	bool status = false;
+	uint8_t *image;
+	img_buffer_t *buf = *bufp;
+	img_buffer_t *spare = NULL;
+
+	config->ssdv_config.ram_buffer = buf->data;
+	config->ssdv_config.ram_size = buf->size;
+	buf->len = 0;
+	if(thumb)
+		thumb->len = 0;
+
+	if(config->ssdv_config.frames > 1 && (spare = imgBufferAcquire(buf->size, TIME_IMMEDIATE)) == NULL)
+		TRACE_WARN("IMG  > No second camera buffer free, frame selection skipped");
+
+	// Lock camera
+	TRACE_INFO("IMG  > Lock camera");
+	chMtxLock(&camera_mtx);
+	TRACE_INFO("IMG  > Locked camera");
+
+	// Radios are only locked out while a frame is sampled (OV2640_Snapshot2RAM),
+	// transmissions waiting for interference_mtx take place in between
+	ov2640_blackout_t blackout;
+	OV2640_GetBlackout(&blackout, true);
+	systime_t start = chVTGetSystemTimeX();
+
+	// Camera detection takes place while it is switched on by OV2640_init
+	if(OV2640_isAvailable()) // OV2640 not known to be absent
 	{
-		TRACE_INFO("IMG  > Do module IMAGE cycle");
-		config->last_update = chVTGetSystemTimeX(); // Update Watchdog timer
+		if(config->ssdv_config.res == RES_MAX) // Attempt maximum resolution (limited by memory)
+		{
+			uint8_t max_quality = OV2640_Quality(config->ssdv_config.quality);
+			uint8_t attempts = PRED_MAX_ATTEMPTS;
+			bool overflow;
 
-		if(!p_sleep(&config->sleep_config))
+			do {
+
+				// Select resolution and quality predicted to fit
+				predictSelect(config->ssdv_config.ram_size, max_quality, &config->ssdv_config.res, &config->ssdv_config.quality);
+
+				// Init camera (only reconfigured if already switched on)
+				if(!OV2640_init(&config->ssdv_config))
+					break;
+
+				// Sample data from DCMI through DMA into RAM
+				tries = 5; // Try 5 times at maximum
+				do { // Try capturing image until capture successful
+					status = OV2640_Snapshot2RAM();
+				} while(!status && --tries);
+
+				overflow = OV2640_BufferOverflow();
+				if(status)
+					predictUpdate(config->ssdv_config.res, config->ssdv_config.quality,
+						overflow ? config->ssdv_config.ram_size : OV2640_getBuffer(&image),
+						overflow, OV2640_GetBrightness());
+
+			} while(status && overflow && --attempts);
+
+			TRACE_INFO("IMG  > Captured with resolution %d quality %d in %d attempts",
+				config->ssdv_config.res, config->ssdv_config.quality, PRED_MAX_ATTEMPTS - attempts + 1);
+
+			config->ssdv_config.res = RES_MAX; // Revert register
+			config->ssdv_config.quality = max_quality;
+
+		} else { // Static resolution
+
+			// Init camera and sample data from DCMI through DMA into RAM
+			if(OV2640_init(&config->ssdv_config)) {
+				tries = 5; // Try 5 times at maximum
+				do { // Try capturing image until capture successful
+					status = OV2640_Snapshot2RAM();
+				} while(!status && --tries);
+			}
+
+			// Learn from static captures too
+			if(status)
+				predictUpdate(config->ssdv_config.res, OV2640_Quality(config->ssdv_config.quality),
+					OV2640_BufferOverflow() ? config->ssdv_config.ram_size : OV2640_getBuffer(&image),
+					OV2640_BufferOverflow(), OV2640_GetBrightness());
+
+		}
+
+		// Capture more frames and keep the best one
+		if(status && spare && !OV2640_BufferOverflow())
 		{
-			uint32_t image_len = 0;
-			uint8_t *image;
+			buf->len = OV2640_getBuffer(&image);
+			uint32_t best = imgScore(buf, config->ssdv_config.callsign);
 
-			// Take photo if camera activated (if camera disabled, camera buffer is probably shared in config file)
-			if(!config->ssdv_config.no_camera)
+			for(uint8_t i=1; i<config->ssdv_config.frames; i++)
 			{
-				// Lock camera
-				TRACE_INFO("IMG  > Lock camera");
-				chMtxLock(&camera_mtx);
-				TRACE_INFO("IMG  > Locked camera");
+				chThdSleepMilliseconds(SCORE_SPACING);
+
+				config->ssdv_config.ram_buffer = spare->data;
+				config->ssdv_config.ram_size = spare->size;
+				if(!OV2640_Snapshot2RAM() || OV2640_BufferOverflow())
+					continue;
+
+				spare->len = OV2640_getBuffer(&image);
+				uint32_t score = imgScore(spare, config->ssdv_config.callsign);
+				if(score > best) { // Keep the better frame
+					img_buffer_t *tmp = buf;
+					buf = spare;
+					spare = tmp;
+					best = score;
+				}
+			}
+			TRACE_INFO("IMG  > Selected frame with score %d", best);
+		}
 
-				// Lock RADIO from producing interferences
-				TRACE_INFO("IMG  > Lock radio");
-				chMtxLock(&interference_mtx);
-				TRACE_INFO("IMG  > Locked radio");
+		// Get image
+		if(status && !buf->len)
+			buf->len = OV2640_getBuffer(&image);
 
-				// Shutdown radios (to avoid interference)
-				radioShutdown(RADIO_2M);
-				radioShutdown(RADIO_70CM);
+		// Thumbnail of the same scene, the running camera is only reconfigured
+		if(status && thumb)
+		{
+			resolution_t res = config->ssdv_config.res;
+
+			TRACE_INFO("IMG  > Capture thumbnail");
+			config->ssdv_config.res = IMG_THUMB_RES;
+			config->ssdv_config.ram_buffer = thumb->data;
+			config->ssdv_config.ram_size = thumb->size;
+			if(OV2640_init(&config->ssdv_config) && OV2640_Snapshot2RAM() && !OV2640_BufferOverflow())
+				thumb->len = OV2640_getBuffer(&image);
+			config->ssdv_config.res = res;
+		}
 
-				uint8_t tries;
-				bool status = false;
+		// Switch off camera
+		OV2640_deinit();
 
-				// Detect camera
-				if(OV2640_isAvailable()) // OV2640 available
-				{
-					TRACE_INFO("IMG  > OV2640 found");
+		TRACE_INFO("IMG  > Image size: %d bytes", buf->len);
 
-					if(config->ssdv_config.res == RES_MAX) // Attempt maximum resolution (limited by memory)
-					{
-						config->ssdv_config.res = RES_UXGA; // Try maximum resolution
+		if(status)
+		{
+			// The thumbnail is transmitted first, the full image follows with the next ID
+			if(thumb && thumb->len) {
+				thumb->id = gimage_id++;
+				TRACE_INFO("IMG  > Thumbnail size: %d bytes", thumb->len);
+			}
+			buf->id = gimage_id++;
+		}
 
-						do {
+	} else { // Camera error
 
-							// Init camera
-							OV2640_init(&config->ssdv_config);
+		TRACE_ERROR("IMG  > No camera found (not probed again yet)");
 
-							// Sample data from DCMI through DMA into RAM
-							tries = 5; // Try 5 times at maximum
-							do { // Try capturing image until capture successful
-								status = OV2640_Snapshot2RAM();
-							} while(!status && --tries);
+	}
 
-							config->ssdv_config.res--; // Decrement resolution in next attempt (if status==false)
+	OV2640_GetBlackout(&blackout, false);
+	TRACE_INFO("IMG  > Radio blackout %d ms in %d samplings (longest %d ms) of %d ms capture time",
+		ST2MS(blackout.total), blackout.samplings, ST2MS(blackout.longest), ST2MS(chVTTimeElapsedSinceX(start)));
 
-						} while(OV2640_BufferOverflow() && config->ssdv_config.res >= RES_QVGA);
+	// Unlock camera
+	TRACE_INFO("IMG  > Unlock camera");
+	chMtxUnlock(&camera_mtx);
+	TRACE_INFO("IMG  > Unlocked camera");
 
-						config->ssdv_config.res = RES_MAX; // Revert register
+	if(spare)
+		imgBufferRelease(spare);
 
-					} else { // Static resolution
+	*bufp = buf;
+	return status && buf->len;
+}
 
-						// Init camera
-						OV2640_init(&config->ssdv_config);
+/*
+ * SD card archiver. Images are written by a background thread after the
+ * camera and radio locks have been released, so SD write time does not
+ * add to the radio blackout window.
+ */
+static mailbox_t img_sd_mb;
+static msg_t img_sd_mb_buffer[IMG_SD_QUEUE];
+static bool img_sd_started;
 
-						// Sample data from DCMI through DMA into RAM
-						tries = 5; // Try 5 times at maximum
-						do { // Try capturing image until capture successful
-							status = OV2640_Snapshot2RAM();
-						} while(!status && --tries);
+static THD_FUNCTION(imgArchiver, arg) {
+	(void)arg;
+	msg_t msg;
 
-					}
+	while(true)
+	{
+		chMBFetch(&img_sd_mb, &msg, TIME_INFINITE);
+		img_buffer_t *buf = (img_buffer_t*)msg;
 
-					// Switch off camera
-					OV2640_deinit();
+		sdArchiveWrite(buf->id, buf->data, buf->len);
+		imgBufferRelease(buf);
+	}
+}
 
-					// Get image
-					image_len = OV2640_getBuffer(&image);
-					TRACE_INFO("IMG  > Image size: %d bytes", image_len);
+static void imgArchiverStart(void)
+{
+	chMtxLock(&img_pool_mtx);
+	if(!img_sd_started) {
+		chMBObjectInit(&img_sd_mb, img_sd_mb_buffer, IMG_SD_QUEUE);
+		chThdCreateFromHeap(NULL, THD_WORKING_AREA_SIZE(2*1024), "IMG SD", LOWPRIO, imgArchiver, NULL);
+		img_sd_started = true;
+	}
+	chMtxUnlock(&img_pool_mtx);
+}
 
-					// Write image to SD card
-					TRACE_INFO("IMG  > Write to SD card");
-					char filename[16];
-					chsnprintf(filename, sizeof(filename), "image%d.jpg", gimage_id);
-					writeBufferToFile(filename, image, image_len);
+/**
+  * Queues an image for the SD card. The archiver takes its own reference,
+  * so the caller keeps its one.
+  */
+static void imgArchive(img_buffer_t *buf)
+{
+	chMtxLock(&img_pool_mtx);
+	buf->refs++;
+	chMtxUnlock(&img_pool_mtx);
 
-				} else { // Camera error
+	if(chMBPost(&img_sd_mb, (msg_t)buf, TIME_IMMEDIATE) != MSG_OK) {
+		TRACE_WARN("IMG  > SD queue full, image ID=%d not archived", buf->id);
+		imgBufferRelease(buf);
+	}
+}
 
-					TRACE_ERROR("IMG  > No camera found");
+/**
+  * Transmitter of an image module. Encodes and transmits the images posted
+  * into its mailbox and releases their buffers afterwards, so the module
+  * can capture the next image in the meantime.
+  */
+static THD_FUNCTION(imgTransmitter, arg) {
+	img_tx_t *tx = (img_tx_t*)arg;
+	msg_t msg;
 
-				}
+	while(true)
+	{
+		chMBFetch(&tx->mb, &msg, TIME_INFINITE);
+		img_buffer_t *buf = (img_buffer_t*)msg;
 
-				// Unlock radio
-				TRACE_INFO("IMG  > Unlock radio");
-				chMtxUnlock(&interference_mtx);
-				TRACE_INFO("IMG  > Unlocked radio");
+		TRACE_INFO("IMG  > Encode/Transmit SSDV ID=%d", buf->id);
+		encode_ssdv(buf->data, buf->len, tx->config, buf->id);
+		imgBufferRelease(buf);
+	}
+}
 
-				// Unlock camera
-				TRACE_INFO("IMG  > Unlock camera");
-				chMtxUnlock(&camera_mtx);
-				TRACE_INFO("IMG  > Unlocked camera");
+/**
+  * Hands an image over to the transmitter, the reference of the caller
+  * moves to the transmitter
+  */
+static void imgTransmit(img_tx_t *tx, img_buffer_t *buf)
+{
+	if(chMBPost(&tx->mb, (msg_t)buf, TIME_IMMEDIATE) != MSG_OK) {
+		TRACE_ERROR("IMG  > Transmitter queue full, image ID=%d dropped", buf->id);
+		imgBufferRelease(buf);
+	}
+}
 
-				// Encode/Transmit SSDV if image sampled successfully
-				if(status)
+/**
+  * Returns true if no image is waiting for the transmitter (the transmitter
+  * may still be sending one)
+  */
+static bool imgTransmitterQueueEmpty(img_tx_t *tx)
+{
+	chSysLock();
+	cnt_t used = chMBGetUsedCountI(&tx->mb);
+	chSysUnlock();
+	return used == 0;
+}
+
+THD_FUNCTION(moduleIMG, arg) {
+	module_conf_t* config = (module_conf_t*)arg;
+	img_tx_t tx;
+
+	// Execute Initial delay
+	if(config->init_delay)
+		chThdSleepMilliseconds(config->init_delay);
+
+	// Print initialization message
+	TRACE_INFO("IMG  > Startup module %s", config->name);
+
+	// Start transmitter
+	tx.config = config;
+	chMBObjectInit(&tx.mb, tx.mb_buffer, IMG_TX_QUEUE);
+	chThdCreateFromHeap(NULL, THD_WORKING_AREA_SIZE(6*1024), "IMG TX", NORMALPRIO, imgTransmitter, &tx);
+	imgArchiverStart();
+
+	systime_t time = chVTGetSystemTimeX();
+	while(true)
+	{
+		TRACE_INFO("IMG  > Do module IMAGE cycle");
+		config->last_update = chVTGetSystemTimeX(); // Update Watchdog timer
+
+		if(!p_sleep(&config->sleep_config))
+		{
+			img_buffer_t *buf;
+
+			if(!imgTransmitterQueueEmpty(&tx)) // Transmitter still busy with the previous images
+			{
+				TRACE_INFO("IMG  > Previous image not transmitted yet");
+
+			} else if(!config->ssdv_config.no_camera) { // Take photo if camera activated
+
+				// Get camera buffer, large enough for the predicted image size
+				size_t size = config->ssdv_config.res == RES_MAX ? 0 :
+					PRED_MARGIN(predictSize(config->ssdv_config.res, OV2640_Quality(config->ssdv_config.quality)));
+
+				if((buf = imgBufferAcquire(size, S2ST(IMG_BUFFER_TIMEOUT))) == NULL)
 				{
-					TRACE_INFO("IMG  > Encode/Transmit SSDV ID=%d", gimage_id++);
-					encode_ssdv(image, image_len, config, gimage_id);
-				}
+					TRACE_WARN("IMG  > No camera buffer free");
 
-			} else {
+				} else {
 
-				image_len = OV2640_getBuffer(&image);
-				TRACE_INFO("IMG  > Image size: %d bytes", image_len);
+					// Get buffer for the thumbnail
+					img_buffer_t *thumb = NULL;
+					if(config->ssdv_config.thumbnail && config->ssdv_config.res > IMG_THUMB_RES
+					&& (thumb = imgBufferAcquire(PRED_MARGIN(predictSize(IMG_THUMB_RES, OV2640_Quality(config->ssdv_config.quality))), TIME_IMMEDIATE)) == NULL)
+						TRACE_WARN("IMG  > No camera buffer free for thumbnail");
+
+					bool status = imgCapture(config, &buf, thumb);
+
+					// A poor scene cancels the full image before it's archived or published
+					bool thumbOK = status && thumb && thumb->len;
+					if(thumbOK && imgScore(thumb, config->ssdv_config.callsign) < SCORE_MIN) {
+						TRACE_WARN("IMG  > Poor scene, image ID=%d cancelled", buf->id);
+						status = false;
+					}
+
+					// Write to SD card in the background
+					if(thumbOK)
+						imgArchive(thumb);
+					if(status)
+						imgArchive(buf);
+
+					// Transmit thumbnail first
+					if(thumbOK) {
+						imgTransmit(&tx, thumb);
+					} else if(thumb) {
+						imgBufferRelease(thumb);
+					}
+
+					// Encode/Transmit SSDV if image sampled successfully
+					if(status) {
+						imgBufferPublish(buf);
+						imgTransmit(&tx, buf);
+					} else {
+						imgBufferRelease(buf);
+					}
+
+				}
+
+			} else { // Camera disabled, transmit the latest image of another module
 
 				TRACE_INFO("IMG  > Camera disabled");
-				TRACE_INFO("IMG  > Encode/Transmit SSDV ID=%d", gimage_id);
-				encode_ssdv(image, image_len, config, gimage_id);
+				if((buf = imgBufferLatest()) != NULL) {
+					TRACE_INFO("IMG  > Image size: %d bytes", buf->len);
+					imgTransmit(&tx, buf);
+				} else {
+					TRACE_WARN("IMG  > No image captured yet");
+				}
 
 			}
 		}
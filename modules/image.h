@@ -3,9 +3,36 @@
 
 #include "ch.h"
 #include "hal.h"
+#include "types.h"
+
+#define IMG_POOL_BUFFERS	4	/* Max. number of camera buffers */
+#define IMG_BUFFER_TIMEOUT	60	/* Max. time in seconds to wait for a free camera buffer */
+#define IMG_TX_QUEUE		2	/* Images queued per module (thumbnail and image) */
+#define IMG_THUMB_RES		RES_QVGA /* Resolution of thumbnails */
+#define IMG_SD_QUEUE		4	/* Images waiting to be written to the SD card */
+
+typedef struct {
+	uint8_t		*data;		// Buffer memory
+	size_t		size;		// Buffer size
+	uint32_t	len;		// JPEG size (0 = no image)
+	uint8_t		id;			// SSDV image ID
+	uint8_t		refs;		// Number of users (0 = free)
+} img_buffer_t;
+
+typedef struct {
+	module_conf_t	*config;				// Module which transmits
+	mailbox_t		mb;						// Images to transmit
+	msg_t			mb_buffer[IMG_TX_QUEUE];
+} img_tx_t;
 
 THD_FUNCTION(moduleIMG, arg);
 
+void imgPoolAdd(uint8_t *data, size_t size);
+img_buffer_t* imgBufferAcquire(size_t size, systime_t timeout);
+void imgBufferRelease(img_buffer_t *buf);
+void imgBufferPublish(img_buffer_t *buf);
+img_buffer_t* imgBufferLatest(void);
+
 extern mutex_t camera_mtx;
 
 #endif
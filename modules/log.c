@@ -8,12 +8,10 @@
 
 #include "debug.h"
 #include "modules.h"
-#include "base.h"
 #include "aprs.h"
 #include <math.h>
 
 static uint16_t pkt[LOG_TRANSMISSION_TIME*3+2];
-static uint8_t pkt_base91[BASE91LEN(sizeof(pkt))];
 static uint32_t nextLogEntryCounter; // Current log pointer (determines next log transmission)
 
 /**
@@ -168,12 +166,7 @@ THD_FUNCTION(moduleLOG, arg)
 					msg.afsk_config = &(config->afsk_config);
 					msg.gfsk_config = &(config->gfsk_config);
 
-					// Deleting buffer
-					for(uint16_t t=0; t<sizeof(pkt_base91); t++)
-						pkt_base91[t] = 0;
-
-					base91_encode((uint8_t*)pkt, pkt_base91, sizeof(pkt));
-					msg.bin_len = aprs_encode_message(msg.msg, msg.mod, &config->aprs_config, APRS_DEST_CALLSIGN, (char*)pkt_base91);
+					msg.bin_len = aprs_encode_data_message(msg.msg, msg.mod, &config->aprs_config, APRS_DEST_CALLSIGN, (uint8_t*)pkt, sizeof(pkt));
 
 					transmitOnRadio(&msg);
 					break;
@@ -120,7 +120,7 @@ THD_FUNCTION(modulePOS, arg) {
 	// Print initialization message
 	TRACE_INFO("POS  > Startup module %s", config->name);
 
-	trackPoint_t *trackPoint = getLastTrackPoint();
+	trackPoint_t trackPoint;
 	systime_t time = chVTGetSystemTimeX();
 
 	systime_t last_config_transmission = chVTGetSystemTimeX();
@@ -132,7 +132,7 @@ THD_FUNCTION(modulePOS, arg) {
 		config->last_update = chVTGetSystemTimeX(); // Update Watchdog timer
 
 		TRACE_INFO("POS  > Get last track point");
-		trackPoint = getLastTrackPoint();
+		getLastTrackPoint(&trackPoint);
 
 		if(!p_sleep(&config->sleep_config))
 		{
@@ -152,7 +152,7 @@ THD_FUNCTION(modulePOS, arg) {
 					msg.gfsk_config = &(config->gfsk_config);
 					msg.afsk_config = &(config->afsk_config);
 
-					msg.bin_len = aprs_encode_position(msg.msg, msg.mod, &(config->aprs_config), trackPoint); // Encode packet
+					msg.bin_len = aprs_encode_position(msg.msg, msg.mod, &(config->aprs_config), &trackPoint); // Encode packet
 					transmitOnRadio(&msg);
 
 					// Telemetry encoding parameter transmission
@@ -187,7 +187,7 @@ THD_FUNCTION(modulePOS, arg) {
 					// Encode packet
 					char fskmsg[256];
 					memcpy(fskmsg, config->ukhas_config.format, sizeof(config->ukhas_config.format));
-					replace_placeholders(fskmsg, sizeof(fskmsg), trackPoint);
+					replace_placeholders(fskmsg, sizeof(fskmsg), &trackPoint);
 					str_replace(fskmsg, sizeof(fskmsg), "<CALL>", config->ukhas_config.callsign);
 					msg.bin_len = 8*chsnprintf((char*)msg.msg, sizeof(fskmsg), "$$$$$%s*%04X\n", fskmsg, crc16(fskmsg));
 
@@ -202,7 +202,7 @@ THD_FUNCTION(modulePOS, arg) {
 					// Encode morse message
 					char morse[128];
 					memcpy(morse, config->morse_config.format, sizeof(config->morse_config.format));
-					replace_placeholders(morse, sizeof(morse), trackPoint);
+					replace_placeholders(morse, sizeof(morse), &trackPoint);
 					str_replace(morse, sizeof(morse), "<CALL>", config->morse_config.callsign);
 
 					// Transmit message
@@ -10,24 +10,204 @@
 #include "pac1720.h"
 #include "radio.h"
 #include "flash.h"
-
-static trackPoint_t trackPoints[2];
-static trackPoint_t* lastTrackPoint;
-static uint32_t logEntryCounter;
+#include "filter.h"
+#include <string.h>
+
+/*
+ * Track point history. The tracker publishes each point into a ring and
+ * readers copy points out. trackSeq is odd while a point is written, a
+ * reader retries if it changed during the copy (seqlock). The tracker is
+ * never blocked by readers.
+ */
+static trackPoint_t trackPoints[TRACK_HISTORY];
+static volatile uint32_t trackSeq;
+static volatile uint32_t lastTrackID;
+static EVENTSOURCE_DECL(trackEvent);	// Broadcast when a track point is published
+static posFilter_t trackFilter;		// Position/velocity estimate, extrapolates missed fixes
+static uint32_t logEntryCounter;		// Next log entry written
+static uint32_t logSectorSeq;			// Sequence number of the current log sector
 static systime_t nextLogEntryTimer;
 
+static void publishTrackPoint(const trackPoint_t *tp)
+{
+	trackSeq++;
+	__DMB();
+	trackPoints[tp->id % TRACK_HISTORY] = *tp;
+	lastTrackID = tp->id;
+	__DMB();
+	trackSeq++;
+
+	chEvtBroadcast(&trackEvent);
+}
+
 /**
-  * Returns most recent track point witch is complete.
+  * Copies the last k track points (newest first) into tps. Returns the
+  * number of points copied, which is less than k if the history is shorter.
   */
-trackPoint_t* getLastTrackPoint(void)
+uint8_t getTrackPoints(trackPoint_t *tps, uint8_t k)
 {
-	return lastTrackPoint;
+	uint32_t seq;
+	uint8_t n;
+
+	do {
+		while((seq = trackSeq) & 1)
+			chThdSleepMilliseconds(1); // Tracker is publishing
+		__DMB();
+
+		uint32_t id = lastTrackID;
+		n = k < TRACK_HISTORY ? k : TRACK_HISTORY;
+		if(n > id+1)
+			n = id+1;
+		for(uint8_t i=0; i<n; i++)
+			tps[i] = trackPoints[(id-i) % TRACK_HISTORY];
+
+		__DMB();
+	} while(seq != trackSeq);
+
+	return n;
+}
+
+/**
+  * Copies the most recent track point which is complete
+  */
+void getLastTrackPoint(trackPoint_t *tp)
+{
+	getTrackPoints(tp, 1);
+}
+
+/**
+  * Returns the serial ID of the most recent track point
+  */
+uint32_t getLastTrackPointID(void)
+{
+	return lastTrackID;
 }
 
 void getLogTrackPoints(logTrackPoint_t* log, uint32_t id, uint8_t size)
 {
-	uint32_t address = LOG_FLASH_ADDR + (id % (LOG_FLASH_SIZE/sizeof(logTrackPoint_t))) * sizeof(logTrackPoint_t);
-	flashRead(address, (char*)log, sizeof(logTrackPoint_t) * size);
+	for(uint8_t i=0; i<size; i++, id++) {
+		if(id % LOG_SECTOR_ENTRIES == 0) { // Sector header, appears as empty entry
+			memset(&log[i], 0xFF, sizeof(logTrackPoint_t));
+			continue;
+		}
+		uint32_t address = LOG_FLASH_ADDR + (id % LOG_ENTRIES) * sizeof(logTrackPoint_t);
+		flashRead(address, (char*)&log[i], sizeof(logTrackPoint_t));
+	}
+}
+
+static bool isLogEntryErased(uint32_t id)
+{
+	logTrackPoint_t pt;
+	flashRead(LOG_FLASH_ADDR + id * sizeof(logTrackPoint_t), (char*)&pt, sizeof(logTrackPoint_t));
+	return pt.time == 0xFFFFFFFF;
+}
+
+/*
+ * Each log sector starts with a header holding a sequence number. The
+ * sector with the highest sequence number is written currently, entries
+ * are appended without gaps. So the log head is found by checking the
+ * sector headers and a binary search for the first erased entry in the
+ * current sector, regardless of the log size and wrap around.
+ */
+static void findLogHead(void)
+{
+	uint32_t sector = LOG_FLASH_SIZE/LOG_FLASH_PAGE_SIZE; // None
+	for(uint32_t i=0; i<LOG_FLASH_SIZE/LOG_FLASH_PAGE_SIZE; i++)
+	{
+		logSectorHeader_t hdr;
+		flashRead(LOG_FLASH_ADDR + i*LOG_FLASH_PAGE_SIZE, (char*)&hdr, sizeof(logSectorHeader_t));
+		if(hdr.magic == LOG_SECTOR_MAGIC && (sector == LOG_FLASH_SIZE/LOG_FLASH_PAGE_SIZE || (int32_t)(hdr.seq - logSectorSeq) > 0)) {
+			sector = i;
+			logSectorSeq = hdr.seq;
+		}
+	}
+
+	if(sector == LOG_FLASH_SIZE/LOG_FLASH_PAGE_SIZE) { // Empty log (or old layout), start at first sector
+		logEntryCounter = 0;
+		return;
+	}
+
+	// Binary search for the first erased entry
+	uint32_t first = sector * LOG_SECTOR_ENTRIES;
+	uint32_t lo = first + 1;
+	uint32_t hi = first + LOG_SECTOR_ENTRIES;
+	while(lo < hi) {
+		uint32_t mid = (lo + hi) / 2;
+		if(isLogEntryErased(mid))
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+	logEntryCounter = lo % LOG_ENTRIES; // Next sector if current one is full
+}
+
+/*
+ * Atmosphere sensors are sampled by a helper thread while the tracking
+ * thread searches for GPS satellites. The results are joined into the
+ * track point afterwards.
+ */
+typedef struct {
+	bool available;			// Sensor found
+	uint32_t press;			// Airpressure in Pa*10
+	uint16_t hum;			// Rel. humidity in %*10
+	int16_t temp;			// Temperature in degC*100
+	systime_t latency;		// Time taken for sampling
+} atmosphere_t;
+
+static bme280_t bmeInt;
+static bme280_t bmeExt;
+static atmosphere_t atmInt;
+static atmosphere_t atmExt;
+static BSEMAPHORE_DECL(sensorsStart, true);
+static BSEMAPHORE_DECL(sensorsDone, true);
+
+static void sampleBME280(bme280_t *bme, atmosphere_t *atm)
+{
+	systime_t start = chVTGetSystemTimeX();
+
+	if(BME280_Ready(bme)) {
+		atm->press = BME280_getPressure(bme, BME280_MEANS);
+		atm->hum = BME280_getHumidity(bme);
+		atm->temp = BME280_getTemperature(bme);
+	}
+	if(!(atm->available = bme->ready)) { // Not found or lost while sampling
+		atm->press = 0;
+		atm->hum = 0;
+		atm->temp = 0;
+	}
+
+	atm->latency = chVTTimeElapsedSinceX(start);
+}
+
+static void joinAtmosphere(trackPoint_t *tp)
+{
+	// Internal BME280
+	if(!atmInt.available)
+		TRACE_ERROR("TRAC > Internal BME280 not available");
+	tp->int_press = atmInt.press;
+	tp->int_hum = atmInt.hum;
+	tp->int_temp = atmInt.temp;
+
+	// External BME280
+	if(!atmExt.available)
+		TRACE_WARN("TRAC > External BME280 not available");
+	tp->ext_press = atmExt.press;
+	tp->ext_hum = atmExt.hum;
+	tp->ext_temp = atmExt.temp;
+
+	TRACE_INFO("TRAC > Sensor latency BME280 INT %d ms, EXT %d ms", ST2MS(atmInt.latency), ST2MS(atmExt.latency));
+}
+
+static THD_FUNCTION(trackingSensors, arg) {
+	(void)arg;
+
+	while(true)
+	{
+		chBSemWait(&sensorsStart);
+		sampleBME280(&bmeInt, &atmInt);
+		sampleBME280(&bmeExt, &atmExt);
+		chBSemSignal(&sensorsDone);
+	}
 }
 
 static void writeLogTrackPoint(trackPoint_t* tp)
@@ -39,7 +219,7 @@ static void writeLogTrackPoint(trackPoint_t* tp)
 	ltp.gps_lon = tp->gps_lon;
 	ltp.gps_alt = tp->gps_alt < 0 ? 0 : (uint16_t)tp->gps_alt & 0xFFFF;
 
-	// Erase flash if start of new sector is reached
+	// Erase flash and write sector header if start of new sector is reached
 	uint32_t address = LOG_FLASH_ADDR + logEntryCounter * sizeof(logTrackPoint_t);
 	if(address % LOG_FLASH_PAGE_SIZE == 0) // Found start of flash sector
 	{
@@ -48,6 +228,15 @@ static void writeLogTrackPoint(trackPoint_t* tp)
 			TRACE_INFO("TRAC > Erase flash %08x", address);
 			flashErase(address, LOG_FLASH_PAGE_SIZE);
 		}
+
+		logSectorHeader_t hdr = {LOG_SECTOR_MAGIC, ++logSectorSeq, {0xFFFFFFFF, 0xFFFFFFFF}};
+		TRACE_INFO("TRAC > Start log sector (ADDR=%08x, SEQ=%d)", address, logSectorSeq);
+		flashSectorBegin(flashSectorAt(address));
+		flashWrite(address, (char*)&hdr, sizeof(logSectorHeader_t));
+		flashSectorEnd(flashSectorAt(address));
+
+		logEntryCounter++;
+		address += sizeof(logTrackPoint_t);
 	}
 
 	// Write data into flash
@@ -63,7 +252,7 @@ static void writeLogTrackPoint(trackPoint_t* tp)
 		TRACE_ERROR("TRAC > Flash write failed");
 
 	// Increment log counter
-	logEntryCounter = (logEntryCounter+1) % (LOG_FLASH_SIZE/sizeof(logTrackPoint_t));
+	logEntryCounter = (logEntryCounter+1) % LOG_ENTRIES;
 }
 
 /**
@@ -76,18 +265,12 @@ THD_FUNCTION(moduleTRACKING, arg) {
 	TRACE_INFO("TRAC > Startup module TRACKING MANAGER");
 
 	uint32_t id = 1;
-	lastTrackPoint = &trackPoints[0];
+	trackPoint_t tp; // Track point in work, published at the end of each cycle
+	memset(&tp, 0, sizeof(tp));
 
 	// Find next free log entry
-	for(uint32_t address = LOG_FLASH_ADDR; address < LOG_FLASH_ADDR+LOG_FLASH_SIZE; address += sizeof(logTrackPoint_t))
-	{
-		logTrackPoint_t pt;
-		flashRead(address, (char*)&pt, sizeof(logTrackPoint_t));
-		if(pt.time == 0xFFFFFFFF)
-			break;
-		logEntryCounter++;
-	}
-	TRACE_WARN("TRAC > Next log entry ID=%d", logEntryCounter);
+	findLogHead();
+	TRACE_WARN("TRAC > Next log entry ID=%d (sector SEQ=%d)", logEntryCounter, logSectorSeq);
 
 
 	// Initial fill by PAC1720 and BME280 and RTC
@@ -95,25 +278,27 @@ THD_FUNCTION(moduleTRACKING, arg) {
 	// Time
 	ptime_t rtc;
 	getTime(&rtc);
-	lastTrackPoint->time.year = rtc.year;
-	lastTrackPoint->time.month = rtc.month;
-	lastTrackPoint->time.day = rtc.day;
-	lastTrackPoint->time.hour = rtc.hour;
-	lastTrackPoint->time.minute = rtc.minute;
-	lastTrackPoint->time.second = rtc.second;
+	tp.time.year = rtc.year;
+	tp.time.month = rtc.month;
+	tp.time.day = rtc.day;
+	tp.time.hour = rtc.hour;
+	tp.time.minute = rtc.minute;
+	tp.time.second = rtc.second;
 
 	// Get last GPS fix from memory
 	logTrackPoint_t lastLogPoint;
-	uint32_t address = LOG_FLASH_ADDR + ((logEntryCounter-1) % (LOG_FLASH_SIZE/sizeof(logTrackPoint_t))) * sizeof(logTrackPoint_t);
-	flashRead(address, (char*)&lastLogPoint, sizeof(logTrackPoint_t));
+	uint32_t last = (logEntryCounter + LOG_ENTRIES - 1) % LOG_ENTRIES;
+	if(last % LOG_SECTOR_ENTRIES == 0) // Sector header, last entry is in previous sector
+		last = (last + LOG_ENTRIES - 1) % LOG_ENTRIES;
+	getLogTrackPoints(&lastLogPoint, last, 1);
 
 	// Last GPS fix
-	lastTrackPoint->gps_lock = 0;
-	lastTrackPoint->gps_lat = lastLogPoint.gps_lat;
-	lastTrackPoint->gps_lon = lastLogPoint.gps_lon;
-	lastTrackPoint->gps_alt = lastLogPoint.gps_alt;
-	lastTrackPoint->gps_sats = 0;
-	lastTrackPoint->gps_ttff = 0;
+	tp.gps_lock = 0;
+	tp.gps_lat = lastLogPoint.gps_lat;
+	tp.gps_lon = lastLogPoint.gps_lon;
+	tp.gps_alt = lastLogPoint.gps_alt;
+	tp.gps_sats = 0;
+	tp.gps_ttff = 0;
 
 	// Debug last stored GPS position
 	if(lastLogPoint.time != 0xFFFFFFFF) {
@@ -122,48 +307,32 @@ THD_FUNCTION(moduleTRACKING, arg) {
 			"%s Latitude: %d.%07ddeg\r\n"
 			"%s Longitude: %d.%07ddeg\r\n"
 			"%s Altitude: %d Meter",
-			TRACE_TAB, lastTrackPoint->gps_lat/10000000, (lastTrackPoint->gps_lat > 0 ? 1:-1)*lastTrackPoint->gps_lat%10000000,
-			TRACE_TAB, lastTrackPoint->gps_lon/10000000, (lastTrackPoint->gps_lon > 0 ? 1:-1)*lastTrackPoint->gps_lon%10000000,
-			TRACE_TAB, lastTrackPoint->gps_alt
+			TRACE_TAB, tp.gps_lat/10000000, (tp.gps_lat > 0 ? 1:-1)*tp.gps_lat%10000000,
+			TRACE_TAB, tp.gps_lon/10000000, (tp.gps_lon > 0 ? 1:-1)*tp.gps_lon%10000000,
+			TRACE_TAB, tp.gps_alt
 		);
 	} else {
 		TRACE_INFO("TRAC > No GPS position in memory");
 	}
 
 	// Voltage/Current
-	lastTrackPoint->adc_solar = getSolarVoltageMV();
-	lastTrackPoint->adc_battery = getBatteryVoltageMV();
-	lastTrackPoint->adc_charge = pac1720_getPowerCharge();
-	lastTrackPoint->adc_discharge = pac1720_getPowerDischarge();
-
-	bme280_t bmeInt;
-	bme280_t bmeExt;
-
-	// Atmosphere condition
-	if(BME280_isAvailable(BME280_ADDRESS_INT)) {
-		BME280_Init(&bmeInt, BME280_ADDRESS_INT);
-		lastTrackPoint->int_press = BME280_getPressure(&bmeInt, 256);
-		lastTrackPoint->int_hum = BME280_getHumidity(&bmeInt);
-		lastTrackPoint->int_temp = BME280_getTemperature(&bmeInt);
-	} else { // No internal BME280 found
-		TRACE_ERROR("TRAC > Internal BME280 not available");
-		lastTrackPoint->int_press = 0;
-		lastTrackPoint->int_hum = 0;
-		lastTrackPoint->int_temp = 0;
-	}
+	tp.adc_solar = getSolarVoltageMV();
+	tp.adc_battery = getBatteryVoltageMV();
+	tp.adc_charge = pac1720_getPowerCharge();
+	tp.adc_discharge = pac1720_getPowerDischarge();
 
-	// External BME280
-	if(BME280_isAvailable(BME280_ADDRESS_EXT)) {
-		BME280_Init(&bmeExt, BME280_ADDRESS_EXT);
-		lastTrackPoint->ext_press = BME280_getPressure(&bmeExt, 256);
-		lastTrackPoint->ext_hum = BME280_getHumidity(&bmeExt);
-		lastTrackPoint->ext_temp = BME280_getTemperature(&bmeExt);
-	} else { // No external BME280 found
-		TRACE_WARN("TRAC > External BME280 not available");
-		lastTrackPoint->ext_press = 0;
-		lastTrackPoint->ext_hum = 0;
-		lastTrackPoint->ext_temp = 0;
-	}
+	// Atmosphere condition (sensors stay initialized from now on)
+	BME280_Open(&bmeInt, BME280_ADDRESS_INT);
+	BME280_Open(&bmeExt, BME280_ADDRESS_EXT);
+	sampleBME280(&bmeInt, &atmInt);
+	sampleBME280(&bmeExt, &atmExt);
+	joinAtmosphere(&tp);
+
+	// Start sensor helper
+	chThdCreateFromHeap(NULL, THD_WORKING_AREA_SIZE(2*1024), "Sensors", NORMALPRIO, trackingSensors, NULL);
+	bool sensorsPending = false; // Sampling started but not joined yet
+
+	publishTrackPoint(&tp);
 
 	systime_t time = chVTGetSystemTimeX();
 	while(true)
@@ -171,8 +340,11 @@ THD_FUNCTION(moduleTRACKING, arg) {
 		TRACE_INFO("TRAC > Do module TRACKING MANAGER cycle");
 		watchdog_tracking = chVTGetSystemTimeX(); // Update watchdog timer
 
-		trackPoint_t* tp = &trackPoints[id % (sizeof(trackPoints) / sizeof(trackPoint_t))]; // Current track point
-		trackPoint_t* ltp = &trackPoints[(id-1) % (sizeof(trackPoints) / sizeof(trackPoint_t))]; // Last track point
+		// Sample I2C sensors while GPS is searching (unless last run is still outstanding)
+		if(!sensorsPending) {
+			chBSemSignal(&sensorsStart);
+			sensorsPending = true;
+		}
 
 		// Search for GPS satellites
 		gpsFix_t gpsFix = {{0,0,0,0,0,0,0},0,0,0,0,0};
@@ -181,8 +353,8 @@ THD_FUNCTION(moduleTRACKING, arg) {
 		uint16_t batt = getBatteryVoltageMV();
 		if(batt >= GPS_ON_VBAT)
 		{
-			// Switch on GPS
-			GPS_Init();
+			// Switch on GPS (or wake it up)
+			GPS_Resume();
 
 			// Search for lock as long enough power is available
 			do {
@@ -191,13 +363,17 @@ THD_FUNCTION(moduleTRACKING, arg) {
 			} while(!isGPSLocked(&gpsFix) && batt >= GPS_OFF_VBAT && chVTGetSystemTimeX() <= time + S2ST(TRACK_CYCLE_TIME-5)); // Do as long no GPS lock and within timeout, timeout=cycle-1sec (-1sec in order to keep synchronization)
 
 			if(batt < GPS_OFF_VBAT) // Switch off GPS at low batt
-				GPS_Deinit();
+				GPS_PowerOff();
+		} else { // GPS may still sleep in backup or cyclic mode
+			GPS_PowerOff();
 		}
 
+		systime_t searched = chVTGetSystemTimeX();
+
 		if(isGPSLocked(&gpsFix)) { // GPS locked
 
-			// Switch off GPS
-			GPS_Deinit();
+			// Put GPS to sleep until next cycle
+			GPS_Suspend(getBatteryVoltageMV(), time + S2ST(TRACK_CYCLE_TIME));
 
 			// Debug
 			TRACE_INFO("TRAC > GPS sampling finished GPS LOCK");
@@ -207,20 +383,20 @@ THD_FUNCTION(moduleTRACKING, arg) {
 			setTime(gpsFix.time);
 
 			// Take time from GPS
-			tp->time.year = gpsFix.time.year;
-			tp->time.month = gpsFix.time.month;
-			tp->time.day = gpsFix.time.day;
-			tp->time.hour = gpsFix.time.hour;
-			tp->time.minute = gpsFix.time.minute;
-			tp->time.second = gpsFix.time.second;
+			tp.time.year = gpsFix.time.year;
+			tp.time.month = gpsFix.time.month;
+			tp.time.day = gpsFix.time.day;
+			tp.time.hour = gpsFix.time.hour;
+			tp.time.minute = gpsFix.time.minute;
+			tp.time.second = gpsFix.time.second;
 
 			// Set new GPS fix
-			tp->gps_lat = gpsFix.lat;
-			tp->gps_lon = gpsFix.lon;
-			tp->gps_alt = gpsFix.alt;
+			tp.gps_lat = gpsFix.lat;
+			tp.gps_lon = gpsFix.lon;
+			tp.gps_alt = gpsFix.alt;
 
-			tp->gps_lock = isGPSLocked(&gpsFix);
-			tp->gps_sats = gpsFix.num_svs;
+			tp.gps_lock = isGPSLocked(&gpsFix);
+			tp.gps_sats = gpsFix.num_svs;
 
 		} else { // GPS lost (keep GPS switched on)
 
@@ -229,60 +405,51 @@ THD_FUNCTION(moduleTRACKING, arg) {
 
 			// Take time from internal RTC
 			getTime(&rtc);
-			tp->time.year = rtc.year;
-			tp->time.month = rtc.month;
-			tp->time.day = rtc.day;
-			tp->time.hour = rtc.hour;
-			tp->time.minute = rtc.minute;
-			tp->time.second = rtc.second;
-
-			// Take GPS fix from old lock
-			tp->gps_lat = ltp->gps_lat;
-			tp->gps_lon = ltp->gps_lon;
-			tp->gps_alt = ltp->gps_alt;
+			tp.time.year = rtc.year;
+			tp.time.month = rtc.month;
+			tp.time.day = rtc.day;
+			tp.time.hour = rtc.hour;
+			tp.time.minute = rtc.minute;
+			tp.time.second = rtc.second;
+
+			// Keep GPS fix of the old lock (still in tp), extrapolated below
 
 			// Mark gpsloss
-			tp->gps_lock = false;
-			tp->gps_sats = 0;
+			tp.gps_lock = false;
+			tp.gps_sats = 0;
 
 		}
 
-		tp->id = id; // Serial ID
-		tp->gps_ttff = ST2S(chVTGetSystemTimeX() - time); // Time to first fix
+		tp.id = id; // Serial ID
+		tp.gps_ttff = ST2S(chVTGetSystemTimeX() - time); // Time to first fix
 
 		// Power management
-		tp->adc_solar = getSolarVoltageMV();
-		tp->adc_battery = getBatteryVoltageMV();
-		tp->adc_charge = pac1720_getAverageChargePower();
-		tp->adc_discharge = pac1720_getAverageDischargePower();
-
-		bme280_t bmeInt;
-		bme280_t bmeExt;
-
-		// Atmosphere condition
-		if(BME280_isAvailable(BME280_ADDRESS_INT)) {
-			BME280_Init(&bmeInt, BME280_ADDRESS_INT);
-			tp->int_press = BME280_getPressure(&bmeInt, 256);
-			tp->int_hum = BME280_getHumidity(&bmeInt);
-			tp->int_temp = BME280_getTemperature(&bmeInt);
-		} else { // No internal BME280 found
-			TRACE_ERROR("TRAC > Internal BME280 not available");
-			tp->int_press = 0;
-			tp->int_hum = 0;
-			tp->int_temp = 0;
+		tp.adc_solar = getSolarVoltageMV();
+		tp.adc_battery = getBatteryVoltageMV();
+		tp.adc_charge = pac1720_getAverageChargePower();
+		tp.adc_discharge = pac1720_getAverageDischargePower();
+
+		// Join atmosphere condition sampled while searching for GPS
+		systime_t join = chVTGetSystemTimeX();
+		if(chBSemWaitTimeout(&sensorsDone, S2ST(TRACK_SENSOR_TIMEOUT)) == MSG_OK) {
+			TRACE_INFO("TRAC > Sensors joined after %d ms", ST2MS(chVTTimeElapsedSinceX(join)));
+			sensorsPending = false;
+			joinAtmosphere(&tp);
+		} else { // Helper still writes the results, join them next cycle
+			TRACE_ERROR("TRAC > Sensors not sampled in time, keep old values");
 		}
 
-		// External BME280
-		if(BME280_isAvailable(BME280_ADDRESS_EXT)) {
-			BME280_Init(&bmeExt, BME280_ADDRESS_EXT);
-			tp->ext_press = BME280_getPressure(&bmeExt, 256);
-			tp->ext_hum = BME280_getHumidity(&bmeExt);
-			tp->ext_temp = BME280_getTemperature(&bmeExt);
-		} else { // No external BME280 found
-			TRACE_WARN("TRAC > External BME280 not available");
-			tp->ext_press = 0;
-			tp->ext_hum = 0;
-			tp->ext_temp = 0;
+		// Filter position, extrapolate it if GPS fix has been missed
+		uint32_t now = date2UnixSeconds(tp.time); // Filter works in seconds
+		int32_t baro = tp.int_press ? BME280_getAltitude(101325, tp.int_press) : 0; // Offset calibrated by GPS
+		if(isGPSLocked(&gpsFix)) {
+			filterGPS(&trackFilter, now, tp.gps_lat, tp.gps_lon, tp.gps_alt, tp.int_press != 0, baro);
+			TRACE_INFO("TRAC > Filter deviation from prediction %d m", trackFilter.error);
+		} else {
+			if(tp.int_press)
+				filterBaro(&trackFilter, now, baro);
+			if(filterPredict(&trackFilter, now, &tp.gps_lat, &tp.gps_lon, &tp.gps_alt))
+				TRACE_INFO("TRAC > Position extrapolated %d s after last fix", now - trackFilter.fix_time);
 		}
 
 		// Trace data
@@ -293,34 +460,42 @@ THD_FUNCTION(moduleTRACKING, arg) {
 					"%s ADC Vbat=%d.%03dV  Vsol=%d.%03dV Pin=%dmW Pout=%dmW\r\n"
 					"%s INT p=%6d.%01dPa T=%2d.%02ddegC phi=%2d.%01d%%\r\n"
 					"%s EXT p=%6d.%01dPa T=%2d.%02ddegC phi=%2d.%01d%%",
-					tp->id,
-					TRACE_TAB, tp->time.year, tp->time.month, tp->time.day, tp->time.hour, tp->time.minute, tp->time.day,
-					TRACE_TAB, tp->gps_lat/10000000, (tp->gps_lat > 0 ? 1:-1)*tp->gps_lat%10000000, tp->gps_lon/10000000, (tp->gps_lon > 0 ? 1:-1)*tp->gps_lon%10000000, tp->gps_alt,
-					TRACE_TAB, tp->gps_sats, tp->gps_ttff,
-					TRACE_TAB, tp->adc_battery/1000, (tp->adc_battery%1000), tp->adc_solar/1000, (tp->adc_solar%1000), tp->adc_charge, tp->adc_discharge,
-					TRACE_TAB, tp->int_press/10, tp->int_press%10, tp->int_temp/100, tp->int_temp%100, tp->int_hum/10, tp->int_hum%10,
-					TRACE_TAB, tp->ext_press/10, tp->ext_press%10, tp->ext_temp/100, tp->ext_temp%100, tp->ext_hum/10, tp->ext_hum%10
+					tp.id,
+					TRACE_TAB, tp.time.year, tp.time.month, tp.time.day, tp.time.hour, tp.time.minute, tp.time.day,
+					TRACE_TAB, tp.gps_lat/10000000, (tp.gps_lat > 0 ? 1:-1)*tp.gps_lat%10000000, tp.gps_lon/10000000, (tp.gps_lon > 0 ? 1:-1)*tp.gps_lon%10000000, tp.gps_alt,
+					TRACE_TAB, tp.gps_sats, tp.gps_ttff,
+					TRACE_TAB, tp.adc_battery/1000, (tp.adc_battery%1000), tp.adc_solar/1000, (tp.adc_solar%1000), tp.adc_charge, tp.adc_discharge,
+					TRACE_TAB, tp.int_press/10, tp.int_press%10, tp.int_temp/100, tp.int_temp%100, tp.int_hum/10, tp.int_hum%10,
+					TRACE_TAB, tp.ext_press/10, tp.ext_press%10, tp.ext_temp/100, tp.ext_temp%100, tp.ext_hum/10, tp.ext_hum%10
 		);
 
 		// Append logging (timeout)
 		if(nextLogEntryTimer <= chVTGetSystemTimeX() && isGPSLocked(&gpsFix))
 		{
-			writeLogTrackPoint(tp);
+			writeLogTrackPoint(&tp);
 			nextLogEntryTimer += S2ST(LOG_CYCLE_TIME);
 		}
 
-		// Switch last recent track point
-		lastTrackPoint = tp;
+		// Publish track point
+		publishTrackPoint(&tp);
+		TRACE_INFO("TRAC > Published %d ms after GPS search", ST2MS(chVTTimeElapsedSinceX(searched)));
 		id++;
 
 		time = chThdSleepUntilWindowed(time, time + S2ST(TRACK_CYCLE_TIME)); // Wait until time + cycletime
 	}
 }
 
+/**
+  * Blocks until the next track point is published
+  */
 void waitForNewTrackPoint(void)
 {
-	uint32_t old_id = getLastTrackPoint()->id;
-	while(old_id == getLastTrackPoint()->id)
-		chThdSleepMilliseconds(1000);
+	event_listener_t el;
+	uint32_t old_id = getLastTrackPointID();
+
+	chEvtRegisterMask(&trackEvent, &el, TRACK_EVENT_MASK);
+	chEvtGetAndClearEvents(TRACK_EVENT_MASK); // Drop broadcasts of an earlier registration
+	while(old_id == getLastTrackPointID())
+		chEvtWaitAny(TRACK_EVENT_MASK);
+	chEvtUnregister(&trackEvent, &el);
 }
-
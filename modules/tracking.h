@@ -8,6 +8,13 @@
 #define LOG_FLASH_ADDR		0x080C0000	/* Log flash memory address */
 #define LOG_FLASH_SIZE		(256*1024)	/* Log flash memory size */
 #define LOG_FLASH_PAGE_SIZE	(128*1024)	/* Log memory sector size */
+#define LOG_SECTOR_MAGIC	0x30474F4C	/* "LOG0", marks a started log sector */
+#define LOG_ENTRIES			(LOG_FLASH_SIZE/sizeof(logTrackPoint_t))		/* Log entries (including sector headers) */
+#define LOG_SECTOR_ENTRIES	(LOG_FLASH_PAGE_SIZE/sizeof(logTrackPoint_t))	/* Log entries per sector, the first is the header */
+
+#define TRACK_HISTORY		8			/* Track points kept in memory */
+#define TRACK_SENSOR_TIMEOUT	10			/* Max. time in s to wait for the sensors after GPS search */
+#define TRACK_EVENT_MASK	EVENT_MASK(0) /* Event flag used by waitForNewTrackPoint */
 
 typedef struct {
 	uint32_t id;			// Serial ID
@@ -45,8 +52,16 @@ typedef struct {
 	int32_t gps_alt;		// Altitude in meter
 } logTrackPoint_t; // !!! IMPORTANT sizeof(logTrackPoint_t) must be multiple of 128*1024 (address is used for flash erase trigger)
 
+typedef struct {
+	uint32_t magic;			// LOG_SECTOR_MAGIC
+	uint32_t seq;			// Sequence number, incremented with every sector started
+	uint32_t reserved[2];
+} logSectorHeader_t; // Occupies the first entry of each log sector, same size as logTrackPoint_t
+
 void waitForNewTrackPoint(void);
-trackPoint_t* getLastTrackPoint(void);
+void getLastTrackPoint(trackPoint_t *tp);
+uint8_t getTrackPoints(trackPoint_t *tps, uint8_t k);
+uint32_t getLastTrackPointID(void);
 void getLogTrackPoints(logTrackPoint_t* log, uint32_t id, uint8_t size);
 THD_FUNCTION(moduleTRACKING, arg);
 
@@ -165,9 +165,30 @@ uint32_t aprs_encode_position(uint8_t* message, mod_t mod, const aprs_config_t *
 }
 
 /**
- * Transmit custom experimental packet
+ * Sends binary data Base91 encoded. The characters are passed to the AX.25
+ * framer as they are produced, so no intermediate buffer is needed.
  */
-uint32_t aprs_encode_experimental(char packetType, uint8_t* message, mod_t mod, const aprs_config_t *config, uint8_t *data, size_t size)
+static void ax25_send_base91(ax25_t *packet, const uint8_t *data, size_t size)
+{
+	base91_t b91;
+	uint8_t out[2];
+	uint8_t n;
+
+	basE91_init(&b91);
+	for(size_t i=0; i<size; i++) {
+		n = basE91_encode_byte(&b91, data[i], out);
+		for(uint8_t j=0; j<n; j++)
+			ax25_send_byte(packet, out[j]);
+	}
+	n = basE91_encode_end(&b91, out);
+	for(uint8_t j=0; j<n; j++)
+		ax25_send_byte(packet, out[j]);
+}
+
+/**
+ * Transmit custom experimental packet, binary data is sent Base91 encoded
+ */
+uint32_t aprs_encode_experimental(char packetType, uint8_t* message, mod_t mod, const aprs_config_t *config, const uint8_t *data, size_t size)
 {
 	ax25_t packet;
 	packet.data = message;
@@ -180,8 +201,7 @@ uint32_t aprs_encode_experimental(char packetType, uint8_t* message, mod_t mod,
 	ax25_send_byte(&packet, packetType);
 
 	// Encode message
-	for(uint16_t i=0; i<size; i++)
-		ax25_send_byte(&packet, data[i]);
+	ax25_send_base91(&packet, data, size);
 
 	// Send footer
 	ax25_send_footer(&packet);
@@ -192,9 +212,10 @@ uint32_t aprs_encode_experimental(char packetType, uint8_t* message, mod_t mod,
 }
 
 /**
- * Transmit message packet
+ * Encodes a message packet to receiver. The message body is text, or data
+ * Base91 encoded if text is NULL.
  */
-uint32_t aprs_encode_message(uint8_t* message, mod_t mod, const aprs_config_t *config, const char *receiver, const char *text)
+static uint32_t aprs_encode_msg(uint8_t* message, mod_t mod, const aprs_config_t *config, const char *receiver, const char *text, const uint8_t *data, size_t size)
 {
 	ax25_t packet;
 	packet.data = message;
@@ -210,7 +231,10 @@ uint32_t aprs_encode_message(uint8_t* message, mod_t mod, const aprs_config_t *c
 	ax25_send_string(&packet, temp);
 
 	ax25_send_byte(&packet, ':');
-	ax25_send_string(&packet, text);
+	if(text)
+		ax25_send_string(&packet, text);
+	else
+		ax25_send_base91(&packet, data, size);
 	ax25_send_byte(&packet, '{');
 
 	chsnprintf(temp, sizeof(temp), "%d", ++msg_id);
@@ -224,6 +248,22 @@ uint32_t aprs_encode_message(uint8_t* message, mod_t mod, const aprs_config_t *c
 	return packet.size;
 }
 
+/**
+ * Transmit message packet
+ */
+uint32_t aprs_encode_message(uint8_t* message, mod_t mod, const aprs_config_t *config, const char *receiver, const char *text)
+{
+	return aprs_encode_msg(message, mod, config, receiver, text, NULL, 0);
+}
+
+/**
+ * Transmit message packet with binary data as text (Base91 encoded)
+ */
+uint32_t aprs_encode_data_message(uint8_t* message, mod_t mod, const aprs_config_t *config, const char *receiver, const uint8_t *data, size_t size)
+{
+	return aprs_encode_msg(message, mod, config, receiver, NULL, data, size);
+}
+
 /**
  * Transmit APRS telemetry configuration
  */
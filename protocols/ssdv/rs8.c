@@ -52,6 +52,1039 @@ static const uint8_t GENPOLY[] = {
 0x00,
 };
 
+/* GENMUL[x][0] = x * g(0), GENMUL[x][j] = x * g(NROOTS - j) in GF(256),
+ * where x is the feedback symbol in polynomial form */
+static const uint8_t GENMUL[256][32] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x01,0x5B,0x7F,0x56,0x10,0x1E,0x0D,0xEB,0x61,0xA5,0x08,0x2A,0x36,0x56,0xAB,0x20,
+ 0x71,0x20,0xAB,0x56,0x36,0x2A,0x08,0xA5,0x61,0xEB,0x0D,0x1E,0x10,0x56,0x7F,0x5B},
+{0x02,0xB6,0xFE,0xAC,0x20,0x3C,0x1A,0x51,0xC2,0xCD,0x10,0x54,0x6C,0xAC,0xD1,0x40,
+ 0xE2,0x40,0xD1,0xAC,0x6C,0x54,0x10,0xCD,0xC2,0x51,0x1A,0x3C,0x20,0xAC,0xFE,0xB6},
+{0x03,0xED,0x81,0xFA,0x30,0x22,0x17,0xBA,0xA3,0x68,0x18,0x7E,0x5A,0xFA,0x7A,0x60,
+ 0x93,0x60,0x7A,0xFA,0x5A,0x7E,0x18,0x68,0xA3,0xBA,0x17,0x22,0x30,0xFA,0x81,0xED},
+{0x04,0xEB,0x7B,0xDF,0x40,0x78,0x34,0xA2,0x03,0x1D,0x20,0xA8,0xD8,0xDF,0x25,0x80,
+ 0x43,0x80,0x25,0xDF,0xD8,0xA8,0x20,0x1D,0x03,0xA2,0x34,0x78,0x40,0xDF,0x7B,0xEB},
+{0x05,0xB0,0x04,0x89,0x50,0x66,0x39,0x49,0x62,0xB8,0x28,0x82,0xEE,0x89,0x8E,0xA0,
+ 0x32,0xA0,0x8E,0x89,0xEE,0x82,0x28,0xB8,0x62,0x49,0x39,0x66,0x50,0x89,0x04,0xB0},
+{0x06,0x5D,0x85,0x73,0x60,0x44,0x2E,0xF3,0xC1,0xD0,0x30,0xFC,0xB4,0x73,0xF4,0xC0,
+ 0xA1,0xC0,0xF4,0x73,0xB4,0xFC,0x30,0xD0,0xC1,0xF3,0x2E,0x44,0x60,0x73,0x85,0x5D},
+{0x07,0x06,0xFA,0x25,0x70,0x5A,0x23,0x18,0xA0,0x75,0x38,0xD6,0x82,0x25,0x5F,0xE0,
+ 0xD0,0xE0,0x5F,0x25,0x82,0xD6,0x38,0x75,0xA0,0x18,0x23,0x5A,0x70,0x25,0xFA,0x06},
+{0x08,0x51,0xF6,0x39,0x80,0xF0,0x68,0xC3,0x06,0x3A,0x40,0xD7,0x37,0x39,0x4A,0x87,
+ 0x86,0x87,0x4A,0x39,0x37,0xD7,0x40,0x3A,0x06,0xC3,0x68,0xF0,0x80,0x39,0xF6,0x51},
+{0x09,0x0A,0x89,0x6F,0x90,0xEE,0x65,0x28,0x67,0x9F,0x48,0xFD,0x01,0x6F,0xE1,0xA7,
+ 0xF7,0xA7,0xE1,0x6F,0x01,0xFD,0x48,0x9F,0x67,0x28,0x65,0xEE,0x90,0x6F,0x89,0x0A},
+{0x0A,0xE7,0x08,0x95,0xA0,0xCC,0x72,0x92,0xC4,0xF7,0x50,0x83,0x5B,0x95,0x9B,0xC7,
+ 0x64,0xC7,0x9B,0x95,0x5B,0x83,0x50,0xF7,0xC4,0x92,0x72,0xCC,0xA0,0x95,0x08,0xE7},
+{0x0B,0xBC,0x77,0xC3,0xB0,0xD2,0x7F,0x79,0xA5,0x52,0x58,0xA9,0x6D,0xC3,0x30,0xE7,
+ 0x15,0xE7,0x30,0xC3,0x6D,0xA9,0x58,0x52,0xA5,0x79,0x7F,0xD2,0xB0,0xC3,0x77,0xBC},
+{0x0C,0xBA,0x8D,0xE6,0xC0,0x88,0x5C,0x61,0x05,0x27,0x60,0x7F,0xEF,0xE6,0x6F,0x07,
+ 0xC5,0x07,0x6F,0xE6,0xEF,0x7F,0x60,0x27,0x05,0x61,0x5C,0x88,0xC0,0xE6,0x8D,0xBA},
+{0x0D,0xE1,0xF2,0xB0,0xD0,0x96,0x51,0x8A,0x64,0x82,0x68,0x55,0xD9,0xB0,0xC4,0x27,
+ 0xB4,0x27,0xC4,0xB0,0xD9,0x55,0x68,0x82,0x64,0x8A,0x51,0x96,0xD0,0xB0,0xF2,0xE1},
+{0x0E,0x0C,0x73,0x4A,0xE0,0xB4,0x46,0x30,0xC7,0xEA,0x70,0x2B,0x83,0x4A,0xBE,0x47,
+ 0x27,0x47,0xBE,0x4A,0x83,0x2B,0x70,0xEA,0xC7,0x30,0x46,0xB4,0xE0,0x4A,0x73,0x0C},
+{0x0F,0x57,0x0C,0x1C,0xF0,0xAA,0x4B,0xDB,0xA6,0x4F,0x78,0x01,0xB5,0x1C,0x15,0x67,
+ 0x56,0x67,0x15,0x1C,0xB5,0x01,0x78,0x4F,0xA6,0xDB,0x4B,0xAA,0xF0,0x1C,0x0C,0x57},
+{0x10,0xA2,0x6B,0x72,0x87,0x67,0xD0,0x01,0x0C,0x74,0x80,0x29,0x6E,0x72,0x94,0x89,
+ 0x8B,0x89,0x94,0x72,0x6E,0x29,0x80,0x74,0x0C,0x01,0xD0,0x67,0x87,0x72,0x6B,0xA2},
+{0x11,0xF9,0x14,0x24,0x97,0x79,0xDD,0xEA,0x6D,0xD1,0x88,0x03,0x58,0x24,0x3F,0xA9,
+ 0xFA,0xA9,0x3F,0x24,0x58,0x03,0x88,0xD1,0x6D,0xEA,0xDD,0x79,0x97,0x24,0x14,0xF9},
+{0x12,0x14,0x95,0xDE,0xA7,0x5B,0xCA,0x50,0xCE,0xB9,0x90,0x7D,0x02,0xDE,0x45,0xC9,
+ 0x69,0xC9,0x45,0xDE,0x02,0x7D,0x90,0xB9,0xCE,0x50,0xCA,0x5B,0xA7,0xDE,0x95,0x14},
+{0x13,0x4F,0xEA,0x88,0xB7,0x45,0xC7,0xBB,0xAF,0x1C,0x98,0x57,0x34,0x88,0xEE,0xE9,
+ 0x18,0xE9,0xEE,0x88,0x34,0x57,0x98,0x1C,0xAF,0xBB,0xC7,0x45,0xB7,0x88,0xEA,0x4F},
+{0x14,0x49,0x10,0xAD,0xC7,0x1F,0xE4,0xA3,0x0F,0x69,0xA0,0x81,0xB6,0xAD,0xB1,0x09,
+ 0xC8,0x09,0xB1,0xAD,0xB6,0x81,0xA0,0x69,0x0F,0xA3,0xE4,0x1F,0xC7,0xAD,0x10,0x49},
+{0x15,0x12,0x6F,0xFB,0xD7,0x01,0xE9,0x48,0x6E,0xCC,0xA8,0xAB,0x80,0xFB,0x1A,0x29,
+ 0xB9,0x29,0x1A,0xFB,0x80,0xAB,0xA8,0xCC,0x6E,0x48,0xE9,0x01,0xD7,0xFB,0x6F,0x12},
+{0x16,0xFF,0xEE,0x01,0xE7,0x23,0xFE,0xF2,0xCD,0xA4,0xB0,0xD5,0xDA,0x01,0x60,0x49,
+ 0x2A,0x49,0x60,0x01,0xDA,0xD5,0xB0,0xA4,0xCD,0xF2,0xFE,0x23,0xE7,0x01,0xEE,0xFF},
+{0x17,0xA4,0x91,0x57,0xF7,0x3D,0xF3,0x19,0xAC,0x01,0xB8,0xFF,0xEC,0x57,0xCB,0x69,
+ 0x5B,0x69,0xCB,0x57,0xEC,0xFF,0xB8,0x01,0xAC,0x19,0xF3,0x3D,0xF7,0x57,0x91,0xA4},
+{0x18,0xF3,0x9D,0x4B,0x07,0x97,0xB8,0xC2,0x0A,0x4E,0xC0,0xFE,0x59,0x4B,0xDE,0x0E,
+ 0x0D,0x0E,0xDE,0x4B,0x59,0xFE,0xC0,0x4E,0x0A,0xC2,0xB8,0x97,0x07,0x4B,0x9D,0xF3},
+{0x19,0xA8,0xE2,0x1D,0x17,0x89,0xB5,0x29,0x6B,0xEB,0xC8,0xD4,0x6F,0x1D,0x75,0x2E,
+ 0x7C,0x2E,0x75,0x1D,0x6F,0xD4,0xC8,0xEB,0x6B,0x29,0xB5,0x89,0x17,0x1D,0xE2,0xA8},
+{0x1A,0x45,0x63,0xE7,0x27,0xAB,0xA2,0x93,0xC8,0x83,0xD0,0xAA,0x35,0xE7,0x0F,0x4E,
+ 0xEF,0x4E,0x0F,0xE7,0x35,0xAA,0xD0,0x83,0xC8,0x93,0xA2,0xAB,0x27,0xE7,0x63,0x45},
+{0x1B,0x1E,0x1C,0xB1,0x37,0xB5,0xAF,0x78,0xA9,0x26,0xD8,0x80,0x03,0xB1,0xA4,0x6E,
+ 0x9E,0x6E,0xA4,0xB1,0x03,0x80,0xD8,0x26,0xA9,0x78,0xAF,0xB5,0x37,0xB1,0x1C,0x1E},
+{0x1C,0x18,0xE6,0x94,0x47,0xEF,0x8C,0x60,0x09,0x53,0xE0,0x56,0x81,0x94,0xFB,0x8E,
+ 0x4E,0x8E,0xFB,0x94,0x81,0x56,0xE0,0x53,0x09,0x60,0x8C,0xEF,0x47,0x94,0xE6,0x18},
+{0x1D,0x43,0x99,0xC2,0x57,0xF1,0x81,0x8B,0x68,0xF6,0xE8,0x7C,0xB7,0xC2,0x50,0xAE,
+ 0x3F,0xAE,0x50,0xC2,0xB7,0x7C,0xE8,0xF6,0x68,0x8B,0x81,0xF1,0x57,0xC2,0x99,0x43},
+{0x1E,0xAE,0x18,0x38,0x67,0xD3,0x96,0x31,0xCB,0x9E,0xF0,0x02,0xED,0x38,0x2A,0xCE,
+ 0xAC,0xCE,0x2A,0x38,0xED,0x02,0xF0,0x9E,0xCB,0x31,0x96,0xD3,0x67,0x38,0x18,0xAE},
+{0x1F,0xF5,0x67,0x6E,0x77,0xCD,0x9B,0xDA,0xAA,0x3B,0xF8,0x28,0xDB,0x6E,0x81,0xEE,
+ 0xDD,0xEE,0x81,0x6E,0xDB,0x28,0xF8,0x3B,0xAA,0xDA,0x9B,0xCD,0x77,0x6E,0x67,0xF5},
+{0x20,0xC3,0xD6,0xE4,0x89,0xCE,0x27,0x02,0x18,0xE8,0x87,0x52,0xDC,0xE4,0xAF,0x95,
+ 0x91,0x95,0xAF,0xE4,0xDC,0x52,0x87,0xE8,0x18,0x02,0x27,0xCE,0x89,0xE4,0xD6,0xC3},
+{0x21,0x98,0xA9,0xB2,0x99,0xD0,0x2A,0xE9,0x79,0x4D,0x8F,0x78,0xEA,0xB2,0x04,0xB5,
+ 0xE0,0xB5,0x04,0xB2,0xEA,0x78,0x8F,0x4D,0x79,0xE9,0x2A,0xD0,0x99,0xB2,0xA9,0x98},
+{0x22,0x75,0x28,0x48,0xA9,0xF2,0x3D,0x53,0xDA,0x25,0x97,0x06,0xB0,0x48,0x7E,0xD5,
+ 0x73,0xD5,0x7E,0x48,0xB0,0x06,0x97,0x25,0xDA,0x53,0x3D,0xF2,0xA9,0x48,0x28,0x75},
+{0x23,0x2E,0x57,0x1E,0xB9,0xEC,0x30,0xB8,0xBB,0x80,0x9F,0x2C,0x86,0x1E,0xD5,0xF5,
+ 0x02,0xF5,0xD5,0x1E,0x86,0x2C,0x9F,0x80,0xBB,0xB8,0x30,0xEC,0xB9,0x1E,0x57,0x2E},
+{0x24,0x28,0xAD,0x3B,0xC9,0xB6,0x13,0xA0,0x1B,0xF5,0xA7,0xFA,0x04,0x3B,0x8A,0x15,
+ 0xD2,0x15,0x8A,0x3B,0x04,0xFA,0xA7,0xF5,0x1B,0xA0,0x13,0xB6,0xC9,0x3B,0xAD,0x28},
+{0x25,0x73,0xD2,0x6D,0xD9,0xA8,0x1E,0x4B,0x7A,0x50,0xAF,0xD0,0x32,0x6D,0x21,0x35,
+ 0xA3,0x35,0x21,0x6D,0x32,0xD0,0xAF,0x50,0x7A,0x4B,0x1E,0xA8,0xD9,0x6D,0xD2,0x73},
+{0x26,0x9E,0x53,0x97,0xE9,0x8A,0x09,0xF1,0xD9,0x38,0xB7,0xAE,0x68,0x97,0x5B,0x55,
+ 0x30,0x55,0x5B,0x97,0x68,0xAE,0xB7,0x38,0xD9,0xF1,0x09,0x8A,0xE9,0x97,0x53,0x9E},
+{0x27,0xC5,0x2C,0xC1,0xF9,0x94,0x04,0x1A,0xB8,0x9D,0xBF,0x84,0x5E,0xC1,0xF0,0x75,
+ 0x41,0x75,0xF0,0xC1,0x5E,0x84,0xBF,0x9D,0xB8,0x1A,0x04,0x94,0xF9,0xC1,0x2C,0xC5},
+{0x28,0x92,0x20,0xDD,0x09,0x3E,0x4F,0xC1,0x1E,0xD2,0xC7,0x85,0xEB,0xDD,0xE5,0x12,
+ 0x17,0x12,0xE5,0xDD,0xEB,0x85,0xC7,0xD2,0x1E,0xC1,0x4F,0x3E,0x09,0xDD,0x20,0x92},
+{0x29,0xC9,0x5F,0x8B,0x19,0x20,0x42,0x2A,0x7F,0x77,0xCF,0xAF,0xDD,0x8B,0x4E,0x32,
+ 0x66,0x32,0x4E,0x8B,0xDD,0xAF,0xCF,0x77,0x7F,0x2A,0x42,0x20,0x19,0x8B,0x5F,0xC9},
+{0x2A,0x24,0xDE,0x71,0x29,0x02,0x55,0x90,0xDC,0x1F,0xD7,0xD1,0x87,0x71,0x34,0x52,
+ 0xF5,0x52,0x34,0x71,0x87,0xD1,0xD7,0x1F,0xDC,0x90,0x55,0x02,0x29,0x71,0xDE,0x24},
+{0x2B,0x7F,0xA1,0x27,0x39,0x1C,0x58,0x7B,0xBD,0xBA,0xDF,0xFB,0xB1,0x27,0x9F,0x72,
+ 0x84,0x72,0x9F,0x27,0xB1,0xFB,0xDF,0xBA,0xBD,0x7B,0x58,0x1C,0x39,0x27,0xA1,0x7F},
+{0x2C,0x79,0x5B,0x02,0x49,0x46,0x7B,0x63,0x1D,0xCF,0xE7,0x2D,0x33,0x02,0xC0,0x92,
+ 0x54,0x92,0xC0,0x02,0x33,0x2D,0xE7,0xCF,0x1D,0x63,0x7B,0x46,0x49,0x02,0x5B,0x79},
+{0x2D,0x22,0x24,0x54,0x59,0x58,0x76,0x88,0x7C,0x6A,0xEF,0x07,0x05,0x54,0x6B,0xB2,
+ 0x25,0xB2,0x6B,0x54,0x05,0x07,0xEF,0x6A,0x7C,0x88,0x76,0x58,0x59,0x54,0x24,0x22},
+{0x2E,0xCF,0xA5,0xAE,0x69,0x7A,0x61,0x32,0xDF,0x02,0xF7,0x79,0x5F,0xAE,0x11,0xD2,
+ 0xB6,0xD2,0x11,0xAE,0x5F,0x79,0xF7,0x02,0xDF,0x32,0x61,0x7A,0x69,0xAE,0xA5,0xCF},
+{0x2F,0x94,0xDA,0xF8,0x79,0x64,0x6C,0xD9,0xBE,0xA7,0xFF,0x53,0x69,0xF8,0xBA,0xF2,
+ 0xC7,0xF2,0xBA,0xF8,0x69,0x53,0xFF,0xA7,0xBE,0xD9,0x6C,0x64,0x79,0xF8,0xDA,0x94},
+{0x30,0x61,0xBD,0x96,0x0E,0xA9,0xF7,0x03,0x14,0x9C,0x07,0x7B,0xB2,0x96,0x3B,0x1C,
+ 0x1A,0x1C,0x3B,0x96,0xB2,0x7B,0x07,0x9C,0x14,0x03,0xF7,0xA9,0x0E,0x96,0xBD,0x61},
+{0x31,0x3A,0xC2,0xC0,0x1E,0xB7,0xFA,0xE8,0x75,0x39,0x0F,0x51,0x84,0xC0,0x90,0x3C,
+ 0x6B,0x3C,0x90,0xC0,0x84,0x51,0x0F,0x39,0x75,0xE8,0xFA,0xB7,0x1E,0xC0,0xC2,0x3A},
+{0x32,0xD7,0x43,0x3A,0x2E,0x95,0xED,0x52,0xD6,0x51,0x17,0x2F,0xDE,0x3A,0xEA,0x5C,
+ 0xF8,0x5C,0xEA,0x3A,0xDE,0x2F,0x17,0x51,0xD6,0x52,0xED,0x95,0x2E,0x3A,0x43,0xD7},
+{0x33,0x8C,0x3C,0x6C,0x3E,0x8B,0xE0,0xB9,0xB7,0xF4,0x1F,0x05,0xE8,0x6C,0x41,0x7C,
+ 0x89,0x7C,0x41,0x6C,0xE8,0x05,0x1F,0xF4,0xB7,0xB9,0xE0,0x8B,0x3E,0x6C,0x3C,0x8C},
+{0x34,0x8A,0xC6,0x49,0x4E,0xD1,0xC3,0xA1,0x17,0x81,0x27,0xD3,0x6A,0x49,0x1E,0x9C,
+ 0x59,0x9C,0x1E,0x49,0x6A,0xD3,0x27,0x81,0x17,0xA1,0xC3,0xD1,0x4E,0x49,0xC6,0x8A},
+{0x35,0xD1,0xB9,0x1F,0x5E,0xCF,0xCE,0x4A,0x76,0x24,0x2F,0xF9,0x5C,0x1F,0xB5,0xBC,
+ 0x28,0xBC,0xB5,0x1F,0x5C,0xF9,0x2F,0x24,0x76,0x4A,0xCE,0xCF,0x5E,0x1F,0xB9,0xD1},
+{0x36,0x3C,0x38,0xE5,0x6E,0xED,0xD9,0xF0,0xD5,0x4C,0x37,0x87,0x06,0xE5,0xCF,0xDC,
+ 0xBB,0xDC,0xCF,0xE5,0x06,0x87,0x37,0x4C,0xD5,0xF0,0xD9,0xED,0x6E,0xE5,0x38,0x3C},
+{0x37,0x67,0x47,0xB3,0x7E,0xF3,0xD4,0x1B,0xB4,0xE9,0x3F,0xAD,0x30,0xB3,0x64,0xFC,
+ 0xCA,0xFC,0x64,0xB3,0x30,0xAD,0x3F,0xE9,0xB4,0x1B,0xD4,0xF3,0x7E,0xB3,0x47,0x67},
+{0x38,0x30,0x4B,0xAF,0x8E,0x59,0x9F,0xC0,0x12,0xA6,0x47,0xAC,0x85,0xAF,0x71,0x9B,
+ 0x9C,0x9B,0x71,0xAF,0x85,0xAC,0x47,0xA6,0x12,0xC0,0x9F,0x59,0x8E,0xAF,0x4B,0x30},
+{0x39,0x6B,0x34,0xF9,0x9E,0x47,0x92,0x2B,0x73,0x03,0x4F,0x86,0xB3,0xF9,0xDA,0xBB,
+ 0xED,0xBB,0xDA,0xF9,0xB3,0x86,0x4F,0x03,0x73,0x2B,0x92,0x47,0x9E,0xF9,0x34,0x6B},
+{0x3A,0x86,0xB5,0x03,0xAE,0x65,0x85,0x91,0xD0,0x6B,0x57,0xF8,0xE9,0x03,0xA0,0xDB,
+ 0x7E,0xDB,0xA0,0x03,0xE9,0xF8,0x57,0x6B,0xD0,0x91,0x85,0x65,0xAE,0x03,0xB5,0x86},
+{0x3B,0xDD,0xCA,0x55,0xBE,0x7B,0x88,0x7A,0xB1,0xCE,0x5F,0xD2,0xDF,0x55,0x0B,0xFB,
+ 0x0F,0xFB,0x0B,0x55,0xDF,0xD2,0x5F,0xCE,0xB1,0x7A,0x88,0x7B,0xBE,0x55,0xCA,0xDD},
+{0x3C,0xDB,0x30,0x70,0xCE,0x21,0xAB,0x62,0x11,0xBB,0x67,0x04,0x5D,0x70,0x54,0x1B,
+ 0xDF,0x1B,0x54,0x70,0x5D,0x04,0x67,0xBB,0x11,0x62,0xAB,0x21,0xCE,0x70,0x30,0xDB},
+{0x3D,0x80,0x4F,0x26,0xDE,0x3F,0xA6,0x89,0x70,0x1E,0x6F,0x2E,0x6B,0x26,0xFF,0x3B,
+ 0xAE,0x3B,0xFF,0x26,0x6B,0x2E,0x6F,0x1E,0x70,0x89,0xA6,0x3F,0xDE,0x26,0x4F,0x80},
+{0x3E,0x6D,0xCE,0xDC,0xEE,0x1D,0xB1,0x33,0xD3,0x76,0x77,0x50,0x31,0xDC,0x85,0x5B,
+ 0x3D,0x5B,0x85,0xDC,0x31,0x50,0x77,0x76,0xD3,0x33,0xB1,0x1D,0xEE,0xDC,0xCE,0x6D},
+{0x3F,0x36,0xB1,0x8A,0xFE,0x03,0xBC,0xD8,0xB2,0xD3,0x7F,0x7A,0x07,0x8A,0x2E,0x7B,
+ 0x4C,0x7B,0x2E,0x8A,0x07,0x7A,0x7F,0xD3,0xB2,0xD8,0xBC,0x03,0xFE,0x8A,0xB1,0x36},
+{0x40,0x01,0x2B,0x4F,0x95,0x1B,0x4E,0x04,0x30,0x57,0x89,0xA4,0x3F,0x4F,0xD9,0xAD,
+ 0xA5,0xAD,0xD9,0x4F,0x3F,0xA4,0x89,0x57,0x30,0x04,0x4E,0x1B,0x95,0x4F,0x2B,0x01},
+{0x41,0x5A,0x54,0x19,0x85,0x05,0x43,0xEF,0x51,0xF2,0x81,0x8E,0x09,0x19,0x72,0x8D,
+ 0xD4,0x8D,0x72,0x19,0x09,0x8E,0x81,0xF2,0x51,0xEF,0x43,0x05,0x85,0x19,0x54,0x5A},
+{0x42,0xB7,0xD5,0xE3,0xB5,0x27,0x54,0x55,0xF2,0x9A,0x99,0xF0,0x53,0xE3,0x08,0xED,
+ 0x47,0xED,0x08,0xE3,0x53,0xF0,0x99,0x9A,0xF2,0x55,0x54,0x27,0xB5,0xE3,0xD5,0xB7},
+{0x43,0xEC,0xAA,0xB5,0xA5,0x39,0x59,0xBE,0x93,0x3F,0x91,0xDA,0x65,0xB5,0xA3,0xCD,
+ 0x36,0xCD,0xA3,0xB5,0x65,0xDA,0x91,0x3F,0x93,0xBE,0x59,0x39,0xA5,0xB5,0xAA,0xEC},
+{0x44,0xEA,0x50,0x90,0xD5,0x63,0x7A,0xA6,0x33,0x4A,0xA9,0x0C,0xE7,0x90,0xFC,0x2D,
+ 0xE6,0x2D,0xFC,0x90,0xE7,0x0C,0xA9,0x4A,0x33,0xA6,0x7A,0x63,0xD5,0x90,0x50,0xEA},
+{0x45,0xB1,0x2F,0xC6,0xC5,0x7D,0x77,0x4D,0x52,0xEF,0xA1,0x26,0xD1,0xC6,0x57,0x0D,
+ 0x97,0x0D,0x57,0xC6,0xD1,0x26,0xA1,0xEF,0x52,0x4D,0x77,0x7D,0xC5,0xC6,0x2F,0xB1},
+{0x46,0x5C,0xAE,0x3C,0xF5,0x5F,0x60,0xF7,0xF1,0x87,0xB9,0x58,0x8B,0x3C,0x2D,0x6D,
+ 0x04,0x6D,0x2D,0x3C,0x8B,0x58,0xB9,0x87,0xF1,0xF7,0x60,0x5F,0xF5,0x3C,0xAE,0x5C},
+{0x47,0x07,0xD1,0x6A,0xE5,0x41,0x6D,0x1C,0x90,0x22,0xB1,0x72,0xBD,0x6A,0x86,0x4D,
+ 0x75,0x4D,0x86,0x6A,0xBD,0x72,0xB1,0x22,0x90,0x1C,0x6D,0x41,0xE5,0x6A,0xD1,0x07},
+{0x48,0x50,0xDD,0x76,0x15,0xEB,0x26,0xC7,0x36,0x6D,0xC9,0x73,0x08,0x76,0x93,0x2A,
+ 0x23,0x2A,0x93,0x76,0x08,0x73,0xC9,0x6D,0x36,0xC7,0x26,0xEB,0x15,0x76,0xDD,0x50},
+{0x49,0x0B,0xA2,0x20,0x05,0xF5,0x2B,0x2C,0x57,0xC8,0xC1,0x59,0x3E,0x20,0x38,0x0A,
+ 0x52,0x0A,0x38,0x20,0x3E,0x59,0xC1,0xC8,0x57,0x2C,0x2B,0xF5,0x05,0x20,0xA2,0x0B},
+{0x4A,0xE6,0x23,0xDA,0x35,0xD7,0x3C,0x96,0xF4,0xA0,0xD9,0x27,0x64,0xDA,0x42,0x6A,
+ 0xC1,0x6A,0x42,0xDA,0x64,0x27,0xD9,0xA0,0xF4,0x96,0x3C,0xD7,0x35,0xDA,0x23,0xE6},
+{0x4B,0xBD,0x5C,0x8C,0x25,0xC9,0x31,0x7D,0x95,0x05,0xD1,0x0D,0x52,0x8C,0xE9,0x4A,
+ 0xB0,0x4A,0xE9,0x8C,0x52,0x0D,0xD1,0x05,0x95,0x7D,0x31,0xC9,0x25,0x8C,0x5C,0xBD},
+{0x4C,0xBB,0xA6,0xA9,0x55,0x93,0x12,0x65,0x35,0x70,0xE9,0xDB,0xD0,0xA9,0xB6,0xAA,
+ 0x60,0xAA,0xB6,0xA9,0xD0,0xDB,0xE9,0x70,0x35,0x65,0x12,0x93,0x55,0xA9,0xA6,0xBB},
+{0x4D,0xE0,0xD9,0xFF,0x45,0x8D,0x1F,0x8E,0x54,0xD5,0xE1,0xF1,0xE6,0xFF,0x1D,0x8A,
+ 0x11,0x8A,0x1D,0xFF,0xE6,0xF1,0xE1,0xD5,0x54,0x8E,0x1F,0x8D,0x45,0xFF,0xD9,0xE0},
+{0x4E,0x0D,0x58,0x05,0x75,0xAF,0x08,0x34,0xF7,0xBD,0xF9,0x8F,0xBC,0x05,0x67,0xEA,
+ 0x82,0xEA,0x67,0x05,0xBC,0x8F,0xF9,0xBD,0xF7,0x34,0x08,0xAF,0x75,0x05,0x58,0x0D},
+{0x4F,0x56,0x27,0x53,0x65,0xB1,0x05,0xDF,0x96,0x18,0xF1,0xA5,0x8A,0x53,0xCC,0xCA,
+ 0xF3,0xCA,0xCC,0x53,0x8A,0xA5,0xF1,0x18,0x96,0xDF,0x05,0xB1,0x65,0x53,0x27,0x56},
+{0x50,0xA3,0x40,0x3D,0x12,0x7C,0x9E,0x05,0x3C,0x23,0x09,0x8D,0x51,0x3D,0x4D,0x24,
+ 0x2E,0x24,0x4D,0x3D,0x51,0x8D,0x09,0x23,0x3C,0x05,0x9E,0x7C,0x12,0x3D,0x40,0xA3},
+{0x51,0xF8,0x3F,0x6B,0x02,0x62,0x93,0xEE,0x5D,0x86,0x01,0xA7,0x67,0x6B,0xE6,0x04,
+ 0x5F,0x04,0xE6,0x6B,0x67,0xA7,0x01,0x86,0x5D,0xEE,0x93,0x62,0x02,0x6B,0x3F,0xF8},
+{0x52,0x15,0xBE,0x91,0x32,0x40,0x84,0x54,0xFE,0xEE,0x19,0xD9,0x3D,0x91,0x9C,0x64,
+ 0xCC,0x64,0x9C,0x91,0x3D,0xD9,0x19,0xEE,0xFE,0x54,0x84,0x40,0x32,0x91,0xBE,0x15},
+{0x53,0x4E,0xC1,0xC7,0x22,0x5E,0x89,0xBF,0x9F,0x4B,0x11,0xF3,0x0B,0xC7,0x37,0x44,
+ 0xBD,0x44,0x37,0xC7,0x0B,0xF3,0x11,0x4B,0x9F,0xBF,0x89,0x5E,0x22,0xC7,0xC1,0x4E},
+{0x54,0x48,0x3B,0xE2,0x52,0x04,0xAA,0xA7,0x3F,0x3E,0x29,0x25,0x89,0xE2,0x68,0xA4,
+ 0x6D,0xA4,0x68,0xE2,0x89,0x25,0x29,0x3E,0x3F,0xA7,0xAA,0x04,0x52,0xE2,0x3B,0x48},
+{0x55,0x13,0x44,0xB4,0x42,0x1A,0xA7,0x4C,0x5E,0x9B,0x21,0x0F,0xBF,0xB4,0xC3,0x84,
+ 0x1C,0x84,0xC3,0xB4,0xBF,0x0F,0x21,0x9B,0x5E,0x4C,0xA7,0x1A,0x42,0xB4,0x44,0x13},
+{0x56,0xFE,0xC5,0x4E,0x72,0x38,0xB0,0xF6,0xFD,0xF3,0x39,0x71,0xE5,0x4E,0xB9,0xE4,
+ 0x8F,0xE4,0xB9,0x4E,0xE5,0x71,0x39,0xF3,0xFD,0xF6,0xB0,0x38,0x72,0x4E,0xC5,0xFE},
+{0x57,0xA5,0xBA,0x18,0x62,0x26,0xBD,0x1D,0x9C,0x56,0x31,0x5B,0xD3,0x18,0x12,0xC4,
+ 0xFE,0xC4,0x12,0x18,0xD3,0x5B,0x31,0x56,0x9C,0x1D,0xBD,0x26,0x62,0x18,0xBA,0xA5},
+{0x58,0xF2,0xB6,0x04,0x92,0x8C,0xF6,0xC6,0x3A,0x19,0x49,0x5A,0x66,0x04,0x07,0xA3,
+ 0xA8,0xA3,0x07,0x04,0x66,0x5A,0x49,0x19,0x3A,0xC6,0xF6,0x8C,0x92,0x04,0xB6,0xF2},
+{0x59,0xA9,0xC9,0x52,0x82,0x92,0xFB,0x2D,0x5B,0xBC,0x41,0x70,0x50,0x52,0xAC,0x83,
+ 0xD9,0x83,0xAC,0x52,0x50,0x70,0x41,0xBC,0x5B,0x2D,0xFB,0x92,0x82,0x52,0xC9,0xA9},
+{0x5A,0x44,0x48,0xA8,0xB2,0xB0,0xEC,0x97,0xF8,0xD4,0x59,0x0E,0x0A,0xA8,0xD6,0xE3,
+ 0x4A,0xE3,0xD6,0xA8,0x0A,0x0E,0x59,0xD4,0xF8,0x97,0xEC,0xB0,0xB2,0xA8,0x48,0x44},
+{0x5B,0x1F,0x37,0xFE,0xA2,0xAE,0xE1,0x7C,0x99,0x71,0x51,0x24,0x3C,0xFE,0x7D,0xC3,
+ 0x3B,0xC3,0x7D,0xFE,0x3C,0x24,0x51,0x71,0x99,0x7C,0xE1,0xAE,0xA2,0xFE,0x37,0x1F},
+{0x5C,0x19,0xCD,0xDB,0xD2,0xF4,0xC2,0x64,0x39,0x04,0x69,0xF2,0xBE,0xDB,0x22,0x23,
+ 0xEB,0x23,0x22,0xDB,0xBE,0xF2,0x69,0x04,0x39,0x64,0xC2,0xF4,0xD2,0xDB,0xCD,0x19},
+{0x5D,0x42,0xB2,0x8D,0xC2,0xEA,0xCF,0x8F,0x58,0xA1,0x61,0xD8,0x88,0x8D,0x89,0x03,
+ 0x9A,0x03,0x89,0x8D,0x88,0xD8,0x61,0xA1,0x58,0x8F,0xCF,0xEA,0xC2,0x8D,0xB2,0x42},
+{0x5E,0xAF,0x33,0x77,0xF2,0xC8,0xD8,0x35,0xFB,0xC9,0x79,0xA6,0xD2,0x77,0xF3,0x63,
+ 0x09,0x63,0xF3,0x77,0xD2,0xA6,0x79,0xC9,0xFB,0x35,0xD8,0xC8,0xF2,0x77,0x33,0xAF},
+{0x5F,0xF4,0x4C,0x21,0xE2,0xD6,0xD5,0xDE,0x9A,0x6C,0x71,0x8C,0xE4,0x21,0x58,0x43,
+ 0x78,0x43,0x58,0x21,0xE4,0x8C,0x71,0x6C,0x9A,0xDE,0xD5,0xD6,0xE2,0x21,0x4C,0xF4},
+{0x60,0xC2,0xFD,0xAB,0x1C,0xD5,0x69,0x06,0x28,0xBF,0x0E,0xF6,0xE3,0xAB,0x76,0x38,
+ 0x34,0x38,0x76,0xAB,0xE3,0xF6,0x0E,0xBF,0x28,0x06,0x69,0xD5,0x1C,0xAB,0xFD,0xC2},
+{0x61,0x99,0x82,0xFD,0x0C,0xCB,0x64,0xED,0x49,0x1A,0x06,0xDC,0xD5,0xFD,0xDD,0x18,
+ 0x45,0x18,0xDD,0xFD,0xD5,0xDC,0x06,0x1A,0x49,0xED,0x64,0xCB,0x0C,0xFD,0x82,0x99},
+{0x62,0x74,0x03,0x07,0x3C,0xE9,0x73,0x57,0xEA,0x72,0x1E,0xA2,0x8F,0x07,0xA7,0x78,
+ 0xD6,0x78,0xA7,0x07,0x8F,0xA2,0x1E,0x72,0xEA,0x57,0x73,0xE9,0x3C,0x07,0x03,0x74},
+{0x63,0x2F,0x7C,0x51,0x2C,0xF7,0x7E,0xBC,0x8B,0xD7,0x16,0x88,0xB9,0x51,0x0C,0x58,
+ 0xA7,0x58,0x0C,0x51,0xB9,0x88,0x16,0xD7,0x8B,0xBC,0x7E,0xF7,0x2C,0x51,0x7C,0x2F},
+{0x64,0x29,0x86,0x74,0x5C,0xAD,0x5D,0xA4,0x2B,0xA2,0x2E,0x5E,0x3B,0x74,0x53,0xB8,
+ 0x77,0xB8,0x53,0x74,0x3B,0x5E,0x2E,0xA2,0x2B,0xA4,0x5D,0xAD,0x5C,0x74,0x86,0x29},
+{0x65,0x72,0xF9,0x22,0x4C,0xB3,0x50,0x4F,0x4A,0x07,0x26,0x74,0x0D,0x22,0xF8,0x98,
+ 0x06,0x98,0xF8,0x22,0x0D,0x74,0x26,0x07,0x4A,0x4F,0x50,0xB3,0x4C,0x22,0xF9,0x72},
+{0x66,0x9F,0x78,0xD8,0x7C,0x91,0x47,0xF5,0xE9,0x6F,0x3E,0x0A,0x57,0xD8,0x82,0xF8,
+ 0x95,0xF8,0x82,0xD8,0x57,0x0A,0x3E,0x6F,0xE9,0xF5,0x47,0x91,0x7C,0xD8,0x78,0x9F},
+{0x67,0xC4,0x07,0x8E,0x6C,0x8F,0x4A,0x1E,0x88,0xCA,0x36,0x20,0x61,0x8E,0x29,0xD8,
+ 0xE4,0xD8,0x29,0x8E,0x61,0x20,0x36,0xCA,0x88,0x1E,0x4A,0x8F,0x6C,0x8E,0x07,0xC4},
+{0x68,0x93,0x0B,0x92,0x9C,0x25,0x01,0xC5,0x2E,0x85,0x4E,0x21,0xD4,0x92,0x3C,0xBF,
+ 0xB2,0xBF,0x3C,0x92,0xD4,0x21,0x4E,0x85,0x2E,0xC5,0x01,0x25,0x9C,0x92,0x0B,0x93},
+{0x69,0xC8,0x74,0xC4,0x8C,0x3B,0x0C,0x2E,0x4F,0x20,0x46,0x0B,0xE2,0xC4,0x97,0x9F,
+ 0xC3,0x9F,0x97,0xC4,0xE2,0x0B,0x46,0x20,0x4F,0x2E,0x0C,0x3B,0x8C,0xC4,0x74,0xC8},
+{0x6A,0x25,0xF5,0x3E,0xBC,0x19,0x1B,0x94,0xEC,0x48,0x5E,0x75,0xB8,0x3E,0xED,0xFF,
+ 0x50,0xFF,0xED,0x3E,0xB8,0x75,0x5E,0x48,0xEC,0x94,0x1B,0x19,0xBC,0x3E,0xF5,0x25},
+{0x6B,0x7E,0x8A,0x68,0xAC,0x07,0x16,0x7F,0x8D,0xED,0x56,0x5F,0x8E,0x68,0x46,0xDF,
+ 0x21,0xDF,0x46,0x68,0x8E,0x5F,0x56,0xED,0x8D,0x7F,0x16,0x07,0xAC,0x68,0x8A,0x7E},
+{0x6C,0x78,0x70,0x4D,0xDC,0x5D,0x35,0x67,0x2D,0x98,0x6E,0x89,0x0C,0x4D,0x19,0x3F,
+ 0xF1,0x3F,0x19,0x4D,0x0C,0x89,0x6E,0x98,0x2D,0x67,0x35,0x5D,0xDC,0x4D,0x70,0x78},
+{0x6D,0x23,0x0F,0x1B,0xCC,0x43,0x38,0x8C,0x4C,0x3D,0x66,0xA3,0x3A,0x1B,0xB2,0x1F,
+ 0x80,0x1F,0xB2,0x1B,0x3A,0xA3,0x66,0x3D,0x4C,0x8C,0x38,0x43,0xCC,0x1B,0x0F,0x23},
+{0x6E,0xCE,0x8E,0xE1,0xFC,0x61,0x2F,0x36,0xEF,0x55,0x7E,0xDD,0x60,0xE1,0xC8,0x7F,
+ 0x13,0x7F,0xC8,0xE1,0x60,0xDD,0x7E,0x55,0xEF,0x36,0x2F,0x61,0xFC,0xE1,0x8E,0xCE},
+{0x6F,0x95,0xF1,0xB7,0xEC,0x7F,0x22,0xDD,0x8E,0xF0,0x76,0xF7,0x56,0xB7,0x63,0x5F,
+ 0x62,0x5F,0x63,0xB7,0x56,0xF7,0x76,0xF0,0x8E,0xDD,0x22,0x7F,0xEC,0xB7,0xF1,0x95},
+{0x70,0x60,0x96,0xD9,0x9B,0xB2,0xB9,0x07,0x24,0xCB,0x8E,0xDF,0x8D,0xD9,0xE2,0xB1,
+ 0xBF,0xB1,0xE2,0xD9,0x8D,0xDF,0x8E,0xCB,0x24,0x07,0xB9,0xB2,0x9B,0xD9,0x96,0x60},
+{0x71,0x3B,0xE9,0x8F,0x8B,0xAC,0xB4,0xEC,0x45,0x6E,0x86,0xF5,0xBB,0x8F,0x49,0x91,
+ 0xCE,0x91,0x49,0x8F,0xBB,0xF5,0x86,0x6E,0x45,0xEC,0xB4,0xAC,0x8B,0x8F,0xE9,0x3B},
+{0x72,0xD6,0x68,0x75,0xBB,0x8E,0xA3,0x56,0xE6,0x06,0x9E,0x8B,0xE1,0x75,0x33,0xF1,
+ 0x5D,0xF1,0x33,0x75,0xE1,0x8B,0x9E,0x06,0xE6,0x56,0xA3,0x8E,0xBB,0x75,0x68,0xD6},
+{0x73,0x8D,0x17,0x23,0xAB,0x90,0xAE,0xBD,0x87,0xA3,0x96,0xA1,0xD7,0x23,0x98,0xD1,
+ 0x2C,0xD1,0x98,0x23,0xD7,0xA1,0x96,0xA3,0x87,0xBD,0xAE,0x90,0xAB,0x23,0x17,0x8D},
+{0x74,0x8B,0xED,0x06,0xDB,0xCA,0x8D,0xA5,0x27,0xD6,0xAE,0x77,0x55,0x06,0xC7,0x31,
+ 0xFC,0x31,0xC7,0x06,0x55,0x77,0xAE,0xD6,0x27,0xA5,0x8D,0xCA,0xDB,0x06,0xED,0x8B},
+{0x75,0xD0,0x92,0x50,0xCB,0xD4,0x80,0x4E,0x46,0x73,0xA6,0x5D,0x63,0x50,0x6C,0x11,
+ 0x8D,0x11,0x6C,0x50,0x63,0x5D,0xA6,0x73,0x46,0x4E,0x80,0xD4,0xCB,0x50,0x92,0xD0},
+{0x76,0x3D,0x13,0xAA,0xFB,0xF6,0x97,0xF4,0xE5,0x1B,0xBE,0x23,0x39,0xAA,0x16,0x71,
+ 0x1E,0x71,0x16,0xAA,0x39,0x23,0xBE,0x1B,0xE5,0xF4,0x97,0xF6,0xFB,0xAA,0x13,0x3D},
+{0x77,0x66,0x6C,0xFC,0xEB,0xE8,0x9A,0x1F,0x84,0xBE,0xB6,0x09,0x0F,0xFC,0xBD,0x51,
+ 0x6F,0x51,0xBD,0xFC,0x0F,0x09,0xB6,0xBE,0x84,0x1F,0x9A,0xE8,0xEB,0xFC,0x6C,0x66},
+{0x78,0x31,0x60,0xE0,0x1B,0x42,0xD1,0xC4,0x22,0xF1,0xCE,0x08,0xBA,0xE0,0xA8,0x36,
+ 0x39,0x36,0xA8,0xE0,0xBA,0x08,0xCE,0xF1,0x22,0xC4,0xD1,0x42,0x1B,0xE0,0x60,0x31},
+{0x79,0x6A,0x1F,0xB6,0x0B,0x5C,0xDC,0x2F,0x43,0x54,0xC6,0x22,0x8C,0xB6,0x03,0x16,
+ 0x48,0x16,0x03,0xB6,0x8C,0x22,0xC6,0x54,0x43,0x2F,0xDC,0x5C,0x0B,0xB6,0x1F,0x6A},
+{0x7A,0x87,0x9E,0x4C,0x3B,0x7E,0xCB,0x95,0xE0,0x3C,0xDE,0x5C,0xD6,0x4C,0x79,0x76,
+ 0xDB,0x76,0x79,0x4C,0xD6,0x5C,0xDE,0x3C,0xE0,0x95,0xCB,0x7E,0x3B,0x4C,0x9E,0x87},
+{0x7B,0xDC,0xE1,0x1A,0x2B,0x60,0xC6,0x7E,0x81,0x99,0xD6,0x76,0xE0,0x1A,0xD2,0x56,
+ 0xAA,0x56,0xD2,0x1A,0xE0,0x76,0xD6,0x99,0x81,0x7E,0xC6,0x60,0x2B,0x1A,0xE1,0xDC},
+{0x7C,0xDA,0x1B,0x3F,0x5B,0x3A,0xE5,0x66,0x21,0xEC,0xEE,0xA0,0x62,0x3F,0x8D,0xB6,
+ 0x7A,0xB6,0x8D,0x3F,0x62,0xA0,0xEE,0xEC,0x21,0x66,0xE5,0x3A,0x5B,0x3F,0x1B,0xDA},
+{0x7D,0x81,0x64,0x69,0x4B,0x24,0xE8,0x8D,0x40,0x49,0xE6,0x8A,0x54,0x69,0x26,0x96,
+ 0x0B,0x96,0x26,0x69,0x54,0x8A,0xE6,0x49,0x40,0x8D,0xE8,0x24,0x4B,0x69,0x64,0x81},
+{0x7E,0x6C,0xE5,0x93,0x7B,0x06,0xFF,0x37,0xE3,0x21,0xFE,0xF4,0x0E,0x93,0x5C,0xF6,
+ 0x98,0xF6,0x5C,0x93,0x0E,0xF4,0xFE,0x21,0xE3,0x37,0xFF,0x06,0x7B,0x93,0xE5,0x6C},
+{0x7F,0x37,0x9A,0xC5,0x6B,0x18,0xF2,0xDC,0x82,0x84,0xF6,0xDE,0x38,0xC5,0xF7,0xD6,
+ 0xE9,0xD6,0xF7,0xC5,0x38,0xDE,0xF6,0x84,0x82,0xDC,0xF2,0x18,0x6B,0xC5,0x9A,0x37},
+{0x80,0x02,0x56,0x9E,0xAD,0x36,0x9C,0x08,0x60,0xAE,0x95,0xCF,0x7E,0x9E,0x35,0xDD,
+ 0xCD,0xDD,0x35,0x9E,0x7E,0xCF,0x95,0xAE,0x60,0x08,0x9C,0x36,0xAD,0x9E,0x56,0x02},
+{0x81,0x59,0x29,0xC8,0xBD,0x28,0x91,0xE3,0x01,0x0B,0x9D,0xE5,0x48,0xC8,0x9E,0xFD,
+ 0xBC,0xFD,0x9E,0xC8,0x48,0xE5,0x9D,0x0B,0x01,0xE3,0x91,0x28,0xBD,0xC8,0x29,0x59},
+{0x82,0xB4,0xA8,0x32,0x8D,0x0A,0x86,0x59,0xA2,0x63,0x85,0x9B,0x12,0x32,0xE4,0x9D,
+ 0x2F,0x9D,0xE4,0x32,0x12,0x9B,0x85,0x63,0xA2,0x59,0x86,0x0A,0x8D,0x32,0xA8,0xB4},
+{0x83,0xEF,0xD7,0x64,0x9D,0x14,0x8B,0xB2,0xC3,0xC6,0x8D,0xB1,0x24,0x64,0x4F,0xBD,
+ 0x5E,0xBD,0x4F,0x64,0x24,0xB1,0x8D,0xC6,0xC3,0xB2,0x8B,0x14,0x9D,0x64,0xD7,0xEF},
+{0x84,0xE9,0x2D,0x41,0xED,0x4E,0xA8,0xAA,0x63,0xB3,0xB5,0x67,0xA6,0x41,0x10,0x5D,
+ 0x8E,0x5D,0x10,0x41,0xA6,0x67,0xB5,0xB3,0x63,0xAA,0xA8,0x4E,0xED,0x41,0x2D,0xE9},
+{0x85,0xB2,0x52,0x17,0xFD,0x50,0xA5,0x41,0x02,0x16,0xBD,0x4D,0x90,0x17,0xBB,0x7D,
+ 0xFF,0x7D,0xBB,0x17,0x90,0x4D,0xBD,0x16,0x02,0x41,0xA5,0x50,0xFD,0x17,0x52,0xB2},
+{0x86,0x5F,0xD3,0xED,0xCD,0x72,0xB2,0xFB,0xA1,0x7E,0xA5,0x33,0xCA,0xED,0xC1,0x1D,
+ 0x6C,0x1D,0xC1,0xED,0xCA,0x33,0xA5,0x7E,0xA1,0xFB,0xB2,0x72,0xCD,0xED,0xD3,0x5F},
+{0x87,0x04,0xAC,0xBB,0xDD,0x6C,0xBF,0x10,0xC0,0xDB,0xAD,0x19,0xFC,0xBB,0x6A,0x3D,
+ 0x1D,0x3D,0x6A,0xBB,0xFC,0x19,0xAD,0xDB,0xC0,0x10,0xBF,0x6C,0xDD,0xBB,0xAC,0x04},
+{0x88,0x53,0xA0,0xA7,0x2D,0xC6,0xF4,0xCB,0x66,0x94,0xD5,0x18,0x49,0xA7,0x7F,0x5A,
+ 0x4B,0x5A,0x7F,0xA7,0x49,0x18,0xD5,0x94,0x66,0xCB,0xF4,0xC6,0x2D,0xA7,0xA0,0x53},
+{0x89,0x08,0xDF,0xF1,0x3D,0xD8,0xF9,0x20,0x07,0x31,0xDD,0x32,0x7F,0xF1,0xD4,0x7A,
+ 0x3A,0x7A,0xD4,0xF1,0x7F,0x32,0xDD,0x31,0x07,0x20,0xF9,0xD8,0x3D,0xF1,0xDF,0x08},
+{0x8A,0xE5,0x5E,0x0B,0x0D,0xFA,0xEE,0x9A,0xA4,0x59,0xC5,0x4C,0x25,0x0B,0xAE,0x1A,
+ 0xA9,0x1A,0xAE,0x0B,0x25,0x4C,0xC5,0x59,0xA4,0x9A,0xEE,0xFA,0x0D,0x0B,0x5E,0xE5},
+{0x8B,0xBE,0x21,0x5D,0x1D,0xE4,0xE3,0x71,0xC5,0xFC,0xCD,0x66,0x13,0x5D,0x05,0x3A,
+ 0xD8,0x3A,0x05,0x5D,0x13,0x66,0xCD,0xFC,0xC5,0x71,0xE3,0xE4,0x1D,0x5D,0x21,0xBE},
+{0x8C,0xB8,0xDB,0x78,0x6D,0xBE,0xC0,0x69,0x65,0x89,0xF5,0xB0,0x91,0x78,0x5A,0xDA,
+ 0x08,0xDA,0x5A,0x78,0x91,0xB0,0xF5,0x89,0x65,0x69,0xC0,0xBE,0x6D,0x78,0xDB,0xB8},
+{0x8D,0xE3,0xA4,0x2E,0x7D,0xA0,0xCD,0x82,0x04,0x2C,0xFD,0x9A,0xA7,0x2E,0xF1,0xFA,
+ 0x79,0xFA,0xF1,0x2E,0xA7,0x9A,0xFD,0x2C,0x04,0x82,0xCD,0xA0,0x7D,0x2E,0xA4,0xE3},
+{0x8E,0x0E,0x25,0xD4,0x4D,0x82,0xDA,0x38,0xA7,0x44,0xE5,0xE4,0xFD,0xD4,0x8B,0x9A,
+ 0xEA,0x9A,0x8B,0xD4,0xFD,0xE4,0xE5,0x44,0xA7,0x38,0xDA,0x82,0x4D,0xD4,0x25,0x0E},
+{0x8F,0x55,0x5A,0x82,0x5D,0x9C,0xD7,0xD3,0xC6,0xE1,0xED,0xCE,0xCB,0x82,0x20,0xBA,
+ 0x9B,0xBA,0x20,0x82,0xCB,0xCE,0xED,0xE1,0xC6,0xD3,0xD7,0x9C,0x5D,0x82,0x5A,0x55},
+{0x90,0xA0,0x3D,0xEC,0x2A,0x51,0x4C,0x09,0x6C,0xDA,0x15,0xE6,0x10,0xEC,0xA1,0x54,
+ 0x46,0x54,0xA1,0xEC,0x10,0xE6,0x15,0xDA,0x6C,0x09,0x4C,0x51,0x2A,0xEC,0x3D,0xA0},
+{0x91,0xFB,0x42,0xBA,0x3A,0x4F,0x41,0xE2,0x0D,0x7F,0x1D,0xCC,0x26,0xBA,0x0A,0x74,
+ 0x37,0x74,0x0A,0xBA,0x26,0xCC,0x1D,0x7F,0x0D,0xE2,0x41,0x4F,0x3A,0xBA,0x42,0xFB},
+{0x92,0x16,0xC3,0x40,0x0A,0x6D,0x56,0x58,0xAE,0x17,0x05,0xB2,0x7C,0x40,0x70,0x14,
+ 0xA4,0x14,0x70,0x40,0x7C,0xB2,0x05,0x17,0xAE,0x58,0x56,0x6D,0x0A,0x40,0xC3,0x16},
+{0x93,0x4D,0xBC,0x16,0x1A,0x73,0x5B,0xB3,0xCF,0xB2,0x0D,0x98,0x4A,0x16,0xDB,0x34,
+ 0xD5,0x34,0xDB,0x16,0x4A,0x98,0x0D,0xB2,0xCF,0xB3,0x5B,0x73,0x1A,0x16,0xBC,0x4D},
+{0x94,0x4B,0x46,0x33,0x6A,0x29,0x78,0xAB,0x6F,0xC7,0x35,0x4E,0xC8,0x33,0x84,0xD4,
+ 0x05,0xD4,0x84,0x33,0xC8,0x4E,0x35,0xC7,0x6F,0xAB,0x78,0x29,0x6A,0x33,0x46,0x4B},
+{0x95,0x10,0x39,0x65,0x7A,0x37,0x75,0x40,0x0E,0x62,0x3D,0x64,0xFE,0x65,0x2F,0xF4,
+ 0x74,0xF4,0x2F,0x65,0xFE,0x64,0x3D,0x62,0x0E,0x40,0x75,0x37,0x7A,0x65,0x39,0x10},
+{0x96,0xFD,0xB8,0x9F,0x4A,0x15,0x62,0xFA,0xAD,0x0A,0x25,0x1A,0xA4,0x9F,0x55,0x94,
+ 0xE7,0x94,0x55,0x9F,0xA4,0x1A,0x25,0x0A,0xAD,0xFA,0x62,0x15,0x4A,0x9F,0xB8,0xFD},
+{0x97,0xA6,0xC7,0xC9,0x5A,0x0B,0x6F,0x11,0xCC,0xAF,0x2D,0x30,0x92,0xC9,0xFE,0xB4,
+ 0x96,0xB4,0xFE,0xC9,0x92,0x30,0x2D,0xAF,0xCC,0x11,0x6F,0x0B,0x5A,0xC9,0xC7,0xA6},
+{0x98,0xF1,0xCB,0xD5,0xAA,0xA1,0x24,0xCA,0x6A,0xE0,0x55,0x31,0x27,0xD5,0xEB,0xD3,
+ 0xC0,0xD3,0xEB,0xD5,0x27,0x31,0x55,0xE0,0x6A,0xCA,0x24,0xA1,0xAA,0xD5,0xCB,0xF1},
+{0x99,0xAA,0xB4,0x83,0xBA,0xBF,0x29,0x21,0x0B,0x45,0x5D,0x1B,0x11,0x83,0x40,0xF3,
+ 0xB1,0xF3,0x40,0x83,0x11,0x1B,0x5D,0x45,0x0B,0x21,0x29,0xBF,0xBA,0x83,0xB4,0xAA},
+{0x9A,0x47,0x35,0x79,0x8A,0x9D,0x3E,0x9B,0xA8,0x2D,0x45,0x65,0x4B,0x79,0x3A,0x93,
+ 0x22,0x93,0x3A,0x79,0x4B,0x65,0x45,0x2D,0xA8,0x9B,0x3E,0x9D,0x8A,0x79,0x35,0x47},
+{0x9B,0x1C,0x4A,0x2F,0x9A,0x83,0x33,0x70,0xC9,0x88,0x4D,0x4F,0x7D,0x2F,0x91,0xB3,
+ 0x53,0xB3,0x91,0x2F,0x7D,0x4F,0x4D,0x88,0xC9,0x70,0x33,0x83,0x9A,0x2F,0x4A,0x1C},
+{0x9C,0x1A,0xB0,0x0A,0xEA,0xD9,0x10,0x68,0x69,0xFD,0x75,0x99,0xFF,0x0A,0xCE,0x53,
+ 0x83,0x53,0xCE,0x0A,0xFF,0x99,0x75,0xFD,0x69,0x68,0x10,0xD9,0xEA,0x0A,0xB0,0x1A},
+{0x9D,0x41,0xCF,0x5C,0xFA,0xC7,0x1D,0x83,0x08,0x58,0x7D,0xB3,0xC9,0x5C,0x65,0x73,
+ 0xF2,0x73,0x65,0x5C,0xC9,0xB3,0x7D,0x58,0x08,0x83,0x1D,0xC7,0xFA,0x5C,0xCF,0x41},
+{0x9E,0xAC,0x4E,0xA6,0xCA,0xE5,0x0A,0x39,0xAB,0x30,0x65,0xCD,0x93,0xA6,0x1F,0x13,
+ 0x61,0x13,0x1F,0xA6,0x93,0xCD,0x65,0x30,0xAB,0x39,0x0A,0xE5,0xCA,0xA6,0x4E,0xAC},
+{0x9F,0xF7,0x31,0xF0,0xDA,0xFB,0x07,0xD2,0xCA,0x95,0x6D,0xE7,0xA5,0xF0,0xB4,0x33,
+ 0x10,0x33,0xB4,0xF0,0xA5,0xE7,0x6D,0x95,0xCA,0xD2,0x07,0xFB,0xDA,0xF0,0x31,0xF7},
+{0xA0,0xC1,0x80,0x7A,0x24,0xF8,0xBB,0x0A,0x78,0x46,0x12,0x9D,0xA2,0x7A,0x9A,0x48,
+ 0x5C,0x48,0x9A,0x7A,0xA2,0x9D,0x12,0x46,0x78,0x0A,0xBB,0xF8,0x24,0x7A,0x80,0xC1},
+{0xA1,0x9A,0xFF,0x2C,0x34,0xE6,0xB6,0xE1,0x19,0xE3,0x1A,0xB7,0x94,0x2C,0x31,0x68,
+ 0x2D,0x68,0x31,0x2C,0x94,0xB7,0x1A,0xE3,0x19,0xE1,0xB6,0xE6,0x34,0x2C,0xFF,0x9A},
+{0xA2,0x77,0x7E,0xD6,0x04,0xC4,0xA1,0x5B,0xBA,0x8B,0x02,0xC9,0xCE,0xD6,0x4B,0x08,
+ 0xBE,0x08,0x4B,0xD6,0xCE,0xC9,0x02,0x8B,0xBA,0x5B,0xA1,0xC4,0x04,0xD6,0x7E,0x77},
+{0xA3,0x2C,0x01,0x80,0x14,0xDA,0xAC,0xB0,0xDB,0x2E,0x0A,0xE3,0xF8,0x80,0xE0,0x28,
+ 0xCF,0x28,0xE0,0x80,0xF8,0xE3,0x0A,0x2E,0xDB,0xB0,0xAC,0xDA,0x14,0x80,0x01,0x2C},
+{0xA4,0x2A,0xFB,0xA5,0x64,0x80,0x8F,0xA8,0x7B,0x5B,0x32,0x35,0x7A,0xA5,0xBF,0xC8,
+ 0x1F,0xC8,0xBF,0xA5,0x7A,0x35,0x32,0x5B,0x7B,0xA8,0x8F,0x80,0x64,0xA5,0xFB,0x2A},
+{0xA5,0x71,0x84,0xF3,0x74,0x9E,0x82,0x43,0x1A,0xFE,0x3A,0x1F,0x4C,0xF3,0x14,0xE8,
+ 0x6E,0xE8,0x14,0xF3,0x4C,0x1F,0x3A,0xFE,0x1A,0x43,0x82,0x9E,0x74,0xF3,0x84,0x71},
+{0xA6,0x9C,0x05,0x09,0x44,0xBC,0x95,0xF9,0xB9,0x96,0x22,0x61,0x16,0x09,0x6E,0x88,
+ 0xFD,0x88,0x6E,0x09,0x16,0x61,0x22,0x96,0xB9,0xF9,0x95,0xBC,0x44,0x09,0x05,0x9C},
+{0xA7,0xC7,0x7A,0x5F,0x54,0xA2,0x98,0x12,0xD8,0x33,0x2A,0x4B,0x20,0x5F,0xC5,0xA8,
+ 0x8C,0xA8,0xC5,0x5F,0x20,0x4B,0x2A,0x33,0xD8,0x12,0x98,0xA2,0x54,0x5F,0x7A,0xC7},
+{0xA8,0x90,0x76,0x43,0xA4,0x08,0xD3,0xC9,0x7E,0x7C,0x52,0x4A,0x95,0x43,0xD0,0xCF,
+ 0xDA,0xCF,0xD0,0x43,0x95,0x4A,0x52,0x7C,0x7E,0xC9,0xD3,0x08,0xA4,0x43,0x76,0x90},
+{0xA9,0xCB,0x09,0x15,0xB4,0x16,0xDE,0x22,0x1F,0xD9,0x5A,0x60,0xA3,0x15,0x7B,0xEF,
+ 0xAB,0xEF,0x7B,0x15,0xA3,0x60,0x5A,0xD9,0x1F,0x22,0xDE,0x16,0xB4,0x15,0x09,0xCB},
+{0xAA,0x26,0x88,0xEF,0x84,0x34,0xC9,0x98,0xBC,0xB1,0x42,0x1E,0xF9,0xEF,0x01,0x8F,
+ 0x38,0x8F,0x01,0xEF,0xF9,0x1E,0x42,0xB1,0xBC,0x98,0xC9,0x34,0x84,0xEF,0x88,0x26},
+{0xAB,0x7D,0xF7,0xB9,0x94,0x2A,0xC4,0x73,0xDD,0x14,0x4A,0x34,0xCF,0xB9,0xAA,0xAF,
+ 0x49,0xAF,0xAA,0xB9,0xCF,0x34,0x4A,0x14,0xDD,0x73,0xC4,0x2A,0x94,0xB9,0xF7,0x7D},
+{0xAC,0x7B,0x0D,0x9C,0xE4,0x70,0xE7,0x6B,0x7D,0x61,0x72,0xE2,0x4D,0x9C,0xF5,0x4F,
+ 0x99,0x4F,0xF5,0x9C,0x4D,0xE2,0x72,0x61,0x7D,0x6B,0xE7,0x70,0xE4,0x9C,0x0D,0x7B},
+{0xAD,0x20,0x72,0xCA,0xF4,0x6E,0xEA,0x80,0x1C,0xC4,0x7A,0xC8,0x7B,0xCA,0x5E,0x6F,
+ 0xE8,0x6F,0x5E,0xCA,0x7B,0xC8,0x7A,0xC4,0x1C,0x80,0xEA,0x6E,0xF4,0xCA,0x72,0x20},
+{0xAE,0xCD,0xF3,0x30,0xC4,0x4C,0xFD,0x3A,0xBF,0xAC,0x62,0xB6,0x21,0x30,0x24,0x0F,
+ 0x7B,0x0F,0x24,0x30,0x21,0xB6,0x62,0xAC,0xBF,0x3A,0xFD,0x4C,0xC4,0x30,0xF3,0xCD},
+{0xAF,0x96,0x8C,0x66,0xD4,0x52,0xF0,0xD1,0xDE,0x09,0x6A,0x9C,0x17,0x66,0x8F,0x2F,
+ 0x0A,0x2F,0x8F,0x66,0x17,0x9C,0x6A,0x09,0xDE,0xD1,0xF0,0x52,0xD4,0x66,0x8C,0x96},
+{0xB0,0x63,0xEB,0x08,0xA3,0x9F,0x6B,0x0B,0x74,0x32,0x92,0xB4,0xCC,0x08,0x0E,0xC1,
+ 0xD7,0xC1,0x0E,0x08,0xCC,0xB4,0x92,0x32,0x74,0x0B,0x6B,0x9F,0xA3,0x08,0xEB,0x63},
+{0xB1,0x38,0x94,0x5E,0xB3,0x81,0x66,0xE0,0x15,0x97,0x9A,0x9E,0xFA,0x5E,0xA5,0xE1,
+ 0xA6,0xE1,0xA5,0x5E,0xFA,0x9E,0x9A,0x97,0x15,0xE0,0x66,0x81,0xB3,0x5E,0x94,0x38},
+{0xB2,0xD5,0x15,0xA4,0x83,0xA3,0x71,0x5A,0xB6,0xFF,0x82,0xE0,0xA0,0xA4,0xDF,0x81,
+ 0x35,0x81,0xDF,0xA4,0xA0,0xE0,0x82,0xFF,0xB6,0x5A,0x71,0xA3,0x83,0xA4,0x15,0xD5},
+{0xB3,0x8E,0x6A,0xF2,0x93,0xBD,0x7C,0xB1,0xD7,0x5A,0x8A,0xCA,0x96,0xF2,0x74,0xA1,
+ 0x44,0xA1,0x74,0xF2,0x96,0xCA,0x8A,0x5A,0xD7,0xB1,0x7C,0xBD,0x93,0xF2,0x6A,0x8E},
+{0xB4,0x88,0x90,0xD7,0xE3,0xE7,0x5F,0xA9,0x77,0x2F,0xB2,0x1C,0x14,0xD7,0x2B,0x41,
+ 0x94,0x41,0x2B,0xD7,0x14,0x1C,0xB2,0x2F,0x77,0xA9,0x5F,0xE7,0xE3,0xD7,0x90,0x88},
+{0xB5,0xD3,0xEF,0x81,0xF3,0xF9,0x52,0x42,0x16,0x8A,0xBA,0x36,0x22,0x81,0x80,0x61,
+ 0xE5,0x61,0x80,0x81,0x22,0x36,0xBA,0x8A,0x16,0x42,0x52,0xF9,0xF3,0x81,0xEF,0xD3},
+{0xB6,0x3E,0x6E,0x7B,0xC3,0xDB,0x45,0xF8,0xB5,0xE2,0xA2,0x48,0x78,0x7B,0xFA,0x01,
+ 0x76,0x01,0xFA,0x7B,0x78,0x48,0xA2,0xE2,0xB5,0xF8,0x45,0xDB,0xC3,0x7B,0x6E,0x3E},
+{0xB7,0x65,0x11,0x2D,0xD3,0xC5,0x48,0x13,0xD4,0x47,0xAA,0x62,0x4E,0x2D,0x51,0x21,
+ 0x07,0x21,0x51,0x2D,0x4E,0x62,0xAA,0x47,0xD4,0x13,0x48,0xC5,0xD3,0x2D,0x11,0x65},
+{0xB8,0x32,0x1D,0x31,0x23,0x6F,0x03,0xC8,0x72,0x08,0xD2,0x63,0xFB,0x31,0x44,0x46,
+ 0x51,0x46,0x44,0x31,0xFB,0x63,0xD2,0x08,0x72,0xC8,0x03,0x6F,0x23,0x31,0x1D,0x32},
+{0xB9,0x69,0x62,0x67,0x33,0x71,0x0E,0x23,0x13,0xAD,0xDA,0x49,0xCD,0x67,0xEF,0x66,
+ 0x20,0x66,0xEF,0x67,0xCD,0x49,0xDA,0xAD,0x13,0x23,0x0E,0x71,0x33,0x67,0x62,0x69},
+{0xBA,0x84,0xE3,0x9D,0x03,0x53,0x19,0x99,0xB0,0xC5,0xC2,0x37,0x97,0x9D,0x95,0x06,
+ 0xB3,0x06,0x95,0x9D,0x97,0x37,0xC2,0xC5,0xB0,0x99,0x19,0x53,0x03,0x9D,0xE3,0x84},
+{0xBB,0xDF,0x9C,0xCB,0x13,0x4D,0x14,0x72,0xD1,0x60,0xCA,0x1D,0xA1,0xCB,0x3E,0x26,
+ 0xC2,0x26,0x3E,0xCB,0xA1,0x1D,0xCA,0x60,0xD1,0x72,0x14,0x4D,0x13,0xCB,0x9C,0xDF},
+{0xBC,0xD9,0x66,0xEE,0x63,0x17,0x37,0x6A,0x71,0x15,0xF2,0xCB,0x23,0xEE,0x61,0xC6,
+ 0x12,0xC6,0x61,0xEE,0x23,0xCB,0xF2,0x15,0x71,0x6A,0x37,0x17,0x63,0xEE,0x66,0xD9},
+{0xBD,0x82,0x19,0xB8,0x73,0x09,0x3A,0x81,0x10,0xB0,0xFA,0xE1,0x15,0xB8,0xCA,0xE6,
+ 0x63,0xE6,0xCA,0xB8,0x15,0xE1,0xFA,0xB0,0x10,0x81,0x3A,0x09,0x73,0xB8,0x19,0x82},
+{0xBE,0x6F,0x98,0x42,0x43,0x2B,0x2D,0x3B,0xB3,0xD8,0xE2,0x9F,0x4F,0x42,0xB0,0x86,
+ 0xF0,0x86,0xB0,0x42,0x4F,0x9F,0xE2,0xD8,0xB3,0x3B,0x2D,0x2B,0x43,0x42,0x98,0x6F},
+{0xBF,0x34,0xE7,0x14,0x53,0x35,0x20,0xD0,0xD2,0x7D,0xEA,0xB5,0x79,0x14,0x1B,0xA6,
+ 0x81,0xA6,0x1B,0x14,0x79,0xB5,0xEA,0x7D,0xD2,0xD0,0x20,0x35,0x53,0x14,0xE7,0x34},
+{0xC0,0x03,0x7D,0xD1,0x38,0x2D,0xD2,0x0C,0x50,0xF9,0x1C,0x6B,0x41,0xD1,0xEC,0x70,
+ 0x68,0x70,0xEC,0xD1,0x41,0x6B,0x1C,0xF9,0x50,0x0C,0xD2,0x2D,0x38,0xD1,0x7D,0x03},
+{0xC1,0x58,0x02,0x87,0x28,0x33,0xDF,0xE7,0x31,0x5C,0x14,0x41,0x77,0x87,0x47,0x50,
+ 0x19,0x50,0x47,0x87,0x77,0x41,0x14,0x5C,0x31,0xE7,0xDF,0x33,0x28,0x87,0x02,0x58},
+{0xC2,0xB5,0x83,0x7D,0x18,0x11,0xC8,0x5D,0x92,0x34,0x0C,0x3F,0x2D,0x7D,0x3D,0x30,
+ 0x8A,0x30,0x3D,0x7D,0x2D,0x3F,0x0C,0x34,0x92,0x5D,0xC8,0x11,0x18,0x7D,0x83,0xB5},
+{0xC3,0xEE,0xFC,0x2B,0x08,0x0F,0xC5,0xB6,0xF3,0x91,0x04,0x15,0x1B,0x2B,0x96,0x10,
+ 0xFB,0x10,0x96,0x2B,0x1B,0x15,0x04,0x91,0xF3,0xB6,0xC5,0x0F,0x08,0x2B,0xFC,0xEE},
+{0xC4,0xE8,0x06,0x0E,0x78,0x55,0xE6,0xAE,0x53,0xE4,0x3C,0xC3,0x99,0x0E,0xC9,0xF0,
+ 0x2B,0xF0,0xC9,0x0E,0x99,0xC3,0x3C,0xE4,0x53,0xAE,0xE6,0x55,0x78,0x0E,0x06,0xE8},
+{0xC5,0xB3,0x79,0x58,0x68,0x4B,0xEB,0x45,0x32,0x41,0x34,0xE9,0xAF,0x58,0x62,0xD0,
+ 0x5A,0xD0,0x62,0x58,0xAF,0xE9,0x34,0x41,0x32,0x45,0xEB,0x4B,0x68,0x58,0x79,0xB3},
+{0xC6,0x5E,0xF8,0xA2,0x58,0x69,0xFC,0xFF,0x91,0x29,0x2C,0x97,0xF5,0xA2,0x18,0xB0,
+ 0xC9,0xB0,0x18,0xA2,0xF5,0x97,0x2C,0x29,0x91,0xFF,0xFC,0x69,0x58,0xA2,0xF8,0x5E},
+{0xC7,0x05,0x87,0xF4,0x48,0x77,0xF1,0x14,0xF0,0x8C,0x24,0xBD,0xC3,0xF4,0xB3,0x90,
+ 0xB8,0x90,0xB3,0xF4,0xC3,0xBD,0x24,0x8C,0xF0,0x14,0xF1,0x77,0x48,0xF4,0x87,0x05},
+{0xC8,0x52,0x8B,0xE8,0xB8,0xDD,0xBA,0xCF,0x56,0xC3,0x5C,0xBC,0x76,0xE8,0xA6,0xF7,
+ 0xEE,0xF7,0xA6,0xE8,0x76,0xBC,0x5C,0xC3,0x56,0xCF,0xBA,0xDD,0xB8,0xE8,0x8B,0x52},
+{0xC9,0x09,0xF4,0xBE,0xA8,0xC3,0xB7,0x24,0x37,0x66,0x54,0x96,0x40,0xBE,0x0D,0xD7,
+ 0x9F,0xD7,0x0D,0xBE,0x40,0x96,0x54,0x66,0x37,0x24,0xB7,0xC3,0xA8,0xBE,0xF4,0x09},
+{0xCA,0xE4,0x75,0x44,0x98,0xE1,0xA0,0x9E,0x94,0x0E,0x4C,0xE8,0x1A,0x44,0x77,0xB7,
+ 0x0C,0xB7,0x77,0x44,0x1A,0xE8,0x4C,0x0E,0x94,0x9E,0xA0,0xE1,0x98,0x44,0x75,0xE4},
+{0xCB,0xBF,0x0A,0x12,0x88,0xFF,0xAD,0x75,0xF5,0xAB,0x44,0xC2,0x2C,0x12,0xDC,0x97,
+ 0x7D,0x97,0xDC,0x12,0x2C,0xC2,0x44,0xAB,0xF5,0x75,0xAD,0xFF,0x88,0x12,0x0A,0xBF},
+{0xCC,0xB9,0xF0,0x37,0xF8,0xA5,0x8E,0x6D,0x55,0xDE,0x7C,0x14,0xAE,0x37,0x83,0x77,
+ 0xAD,0x77,0x83,0x37,0xAE,0x14,0x7C,0xDE,0x55,0x6D,0x8E,0xA5,0xF8,0x37,0xF0,0xB9},
+{0xCD,0xE2,0x8F,0x61,0xE8,0xBB,0x83,0x86,0x34,0x7B,0x74,0x3E,0x98,0x61,0x28,0x57,
+ 0xDC,0x57,0x28,0x61,0x98,0x3E,0x74,0x7B,0x34,0x86,0x83,0xBB,0xE8,0x61,0x8F,0xE2},
+{0xCE,0x0F,0x0E,0x9B,0xD8,0x99,0x94,0x3C,0x97,0x13,0x6C,0x40,0xC2,0x9B,0x52,0x37,
+ 0x4F,0x37,0x52,0x9B,0xC2,0x40,0x6C,0x13,0x97,0x3C,0x94,0x99,0xD8,0x9B,0x0E,0x0F},
+{0xCF,0x54,0x71,0xCD,0xC8,0x87,0x99,0xD7,0xF6,0xB6,0x64,0x6A,0xF4,0xCD,0xF9,0x17,
+ 0x3E,0x17,0xF9,0xCD,0xF4,0x6A,0x64,0xB6,0xF6,0xD7,0x99,0x87,0xC8,0xCD,0x71,0x54},
+{0xD0,0xA1,0x16,0xA3,0xBF,0x4A,0x02,0x0D,0x5C,0x8D,0x9C,0x42,0x2F,0xA3,0x78,0xF9,
+ 0xE3,0xF9,0x78,0xA3,0x2F,0x42,0x9C,0x8D,0x5C,0x0D,0x02,0x4A,0xBF,0xA3,0x16,0xA1},
+{0xD1,0xFA,0x69,0xF5,0xAF,0x54,0x0F,0xE6,0x3D,0x28,0x94,0x68,0x19,0xF5,0xD3,0xD9,
+ 0x92,0xD9,0xD3,0xF5,0x19,0x68,0x94,0x28,0x3D,0xE6,0x0F,0x54,0xAF,0xF5,0x69,0xFA},
+{0xD2,0x17,0xE8,0x0F,0x9F,0x76,0x18,0x5C,0x9E,0x40,0x8C,0x16,0x43,0x0F,0xA9,0xB9,
+ 0x01,0xB9,0xA9,0x0F,0x43,0x16,0x8C,0x40,0x9E,0x5C,0x18,0x76,0x9F,0x0F,0xE8,0x17},
+{0xD3,0x4C,0x97,0x59,0x8F,0x68,0x15,0xB7,0xFF,0xE5,0x84,0x3C,0x75,0x59,0x02,0x99,
+ 0x70,0x99,0x02,0x59,0x75,0x3C,0x84,0xE5,0xFF,0xB7,0x15,0x68,0x8F,0x59,0x97,0x4C},
+{0xD4,0x4A,0x6D,0x7C,0xFF,0x32,0x36,0xAF,0x5F,0x90,0xBC,0xEA,0xF7,0x7C,0x5D,0x79,
+ 0xA0,0x79,0x5D,0x7C,0xF7,0xEA,0xBC,0x90,0x5F,0xAF,0x36,0x32,0xFF,0x7C,0x6D,0x4A},
+{0xD5,0x11,0x12,0x2A,0xEF,0x2C,0x3B,0x44,0x3E,0x35,0xB4,0xC0,0xC1,0x2A,0xF6,0x59,
+ 0xD1,0x59,0xF6,0x2A,0xC1,0xC0,0xB4,0x35,0x3E,0x44,0x3B,0x2C,0xEF,0x2A,0x12,0x11},
+{0xD6,0xFC,0x93,0xD0,0xDF,0x0E,0x2C,0xFE,0x9D,0x5D,0xAC,0xBE,0x9B,0xD0,0x8C,0x39,
+ 0x42,0x39,0x8C,0xD0,0x9B,0xBE,0xAC,0x5D,0x9D,0xFE,0x2C,0x0E,0xDF,0xD0,0x93,0xFC},
+{0xD7,0xA7,0xEC,0x86,0xCF,0x10,0x21,0x15,0xFC,0xF8,0xA4,0x94,0xAD,0x86,0x27,0x19,
+ 0x33,0x19,0x27,0x86,0xAD,0x94,0xA4,0xF8,0xFC,0x15,0x21,0x10,0xCF,0x86,0xEC,0xA7},
+{0xD8,0xF0,0xE0,0x9A,0x3F,0xBA,0x6A,0xCE,0x5A,0xB7,0xDC,0x95,0x18,0x9A,0x32,0x7E,
+ 0x65,0x7E,0x32,0x9A,0x18,0x95,0xDC,0xB7,0x5A,0xCE,0x6A,0xBA,0x3F,0x9A,0xE0,0xF0},
+{0xD9,0xAB,0x9F,0xCC,0x2F,0xA4,0x67,0x25,0x3B,0x12,0xD4,0xBF,0x2E,0xCC,0x99,0x5E,
+ 0x14,0x5E,0x99,0xCC,0x2E,0xBF,0xD4,0x12,0x3B,0x25,0x67,0xA4,0x2F,0xCC,0x9F,0xAB},
+{0xDA,0x46,0x1E,0x36,0x1F,0x86,0x70,0x9F,0x98,0x7A,0xCC,0xC1,0x74,0x36,0xE3,0x3E,
+ 0x87,0x3E,0xE3,0x36,0x74,0xC1,0xCC,0x7A,0x98,0x9F,0x70,0x86,0x1F,0x36,0x1E,0x46},
+{0xDB,0x1D,0x61,0x60,0x0F,0x98,0x7D,0x74,0xF9,0xDF,0xC4,0xEB,0x42,0x60,0x48,0x1E,
+ 0xF6,0x1E,0x48,0x60,0x42,0xEB,0xC4,0xDF,0xF9,0x74,0x7D,0x98,0x0F,0x60,0x61,0x1D},
+{0xDC,0x1B,0x9B,0x45,0x7F,0xC2,0x5E,0x6C,0x59,0xAA,0xFC,0x3D,0xC0,0x45,0x17,0xFE,
+ 0x26,0xFE,0x17,0x45,0xC0,0x3D,0xFC,0xAA,0x59,0x6C,0x5E,0xC2,0x7F,0x45,0x9B,0x1B},
+{0xDD,0x40,0xE4,0x13,0x6F,0xDC,0x53,0x87,0x38,0x0F,0xF4,0x17,0xF6,0x13,0xBC,0xDE,
+ 0x57,0xDE,0xBC,0x13,0xF6,0x17,0xF4,0x0F,0x38,0x87,0x53,0xDC,0x6F,0x13,0xE4,0x40},
+{0xDE,0xAD,0x65,0xE9,0x5F,0xFE,0x44,0x3D,0x9B,0x67,0xEC,0x69,0xAC,0xE9,0xC6,0xBE,
+ 0xC4,0xBE,0xC6,0xE9,0xAC,0x69,0xEC,0x67,0x9B,0x3D,0x44,0xFE,0x5F,0xE9,0x65,0xAD},
+{0xDF,0xF6,0x1A,0xBF,0x4F,0xE0,0x49,0xD6,0xFA,0xC2,0xE4,0x43,0x9A,0xBF,0x6D,0x9E,
+ 0xB5,0x9E,0x6D,0xBF,0x9A,0x43,0xE4,0xC2,0xFA,0xD6,0x49,0xE0,0x4F,0xBF,0x1A,0xF6},
+{0xE0,0xC0,0xAB,0x35,0xB1,0xE3,0xF5,0x0E,0x48,0x11,0x9B,0x39,0x9D,0x35,0x43,0xE5,
+ 0xF9,0xE5,0x43,0x35,0x9D,0x39,0x9B,0x11,0x48,0x0E,0xF5,0xE3,0xB1,0x35,0xAB,0xC0},
+{0xE1,0x9B,0xD4,0x63,0xA1,0xFD,0xF8,0xE5,0x29,0xB4,0x93,0x13,0xAB,0x63,0xE8,0xC5,
+ 0x88,0xC5,0xE8,0x63,0xAB,0x13,0x93,0xB4,0x29,0xE5,0xF8,0xFD,0xA1,0x63,0xD4,0x9B},
+{0xE2,0x76,0x55,0x99,0x91,0xDF,0xEF,0x5F,0x8A,0xDC,0x8B,0x6D,0xF1,0x99,0x92,0xA5,
+ 0x1B,0xA5,0x92,0x99,0xF1,0x6D,0x8B,0xDC,0x8A,0x5F,0xEF,0xDF,0x91,0x99,0x55,0x76},
+{0xE3,0x2D,0x2A,0xCF,0x81,0xC1,0xE2,0xB4,0xEB,0x79,0x83,0x47,0xC7,0xCF,0x39,0x85,
+ 0x6A,0x85,0x39,0xCF,0xC7,0x47,0x83,0x79,0xEB,0xB4,0xE2,0xC1,0x81,0xCF,0x2A,0x2D},
+{0xE4,0x2B,0xD0,0xEA,0xF1,0x9B,0xC1,0xAC,0x4B,0x0C,0xBB,0x91,0x45,0xEA,0x66,0x65,
+ 0xBA,0x65,0x66,0xEA,0x45,0x91,0xBB,0x0C,0x4B,0xAC,0xC1,0x9B,0xF1,0xEA,0xD0,0x2B},
+{0xE5,0x70,0xAF,0xBC,0xE1,0x85,0xCC,0x47,0x2A,0xA9,0xB3,0xBB,0x73,0xBC,0xCD,0x45,
+ 0xCB,0x45,0xCD,0xBC,0x73,0xBB,0xB3,0xA9,0x2A,0x47,0xCC,0x85,0xE1,0xBC,0xAF,0x70},
+{0xE6,0x9D,0x2E,0x46,0xD1,0xA7,0xDB,0xFD,0x89,0xC1,0xAB,0xC5,0x29,0x46,0xB7,0x25,
+ 0x58,0x25,0xB7,0x46,0x29,0xC5,0xAB,0xC1,0x89,0xFD,0xDB,0xA7,0xD1,0x46,0x2E,0x9D},
+{0xE7,0xC6,0x51,0x10,0xC1,0xB9,0xD6,0x16,0xE8,0x64,0xA3,0xEF,0x1F,0x10,0x1C,0x05,
+ 0x29,0x05,0x1C,0x10,0x1F,0xEF,0xA3,0x64,0xE8,0x16,0xD6,0xB9,0xC1,0x10,0x51,0xC6},
+{0xE8,0x91,0x5D,0x0C,0x31,0x13,0x9D,0xCD,0x4E,0x2B,0xDB,0xEE,0xAA,0x0C,0x09,0x62,
+ 0x7F,0x62,0x09,0x0C,0xAA,0xEE,0xDB,0x2B,0x4E,0xCD,0x9D,0x13,0x31,0x0C,0x5D,0x91},
+{0xE9,0xCA,0x22,0x5A,0x21,0x0D,0x90,0x26,0x2F,0x8E,0xD3,0xC4,0x9C,0x5A,0xA2,0x42,
+ 0x0E,0x42,0xA2,0x5A,0x9C,0xC4,0xD3,0x8E,0x2F,0x26,0x90,0x0D,0x21,0x5A,0x22,0xCA},
+{0xEA,0x27,0xA3,0xA0,0x11,0x2F,0x87,0x9C,0x8C,0xE6,0xCB,0xBA,0xC6,0xA0,0xD8,0x22,
+ 0x9D,0x22,0xD8,0xA0,0xC6,0xBA,0xCB,0xE6,0x8C,0x9C,0x87,0x2F,0x11,0xA0,0xA3,0x27},
+{0xEB,0x7C,0xDC,0xF6,0x01,0x31,0x8A,0x77,0xED,0x43,0xC3,0x90,0xF0,0xF6,0x73,0x02,
+ 0xEC,0x02,0x73,0xF6,0xF0,0x90,0xC3,0x43,0xED,0x77,0x8A,0x31,0x01,0xF6,0xDC,0x7C},
+{0xEC,0x7A,0x26,0xD3,0x71,0x6B,0xA9,0x6F,0x4D,0x36,0xFB,0x46,0x72,0xD3,0x2C,0xE2,
+ 0x3C,0xE2,0x2C,0xD3,0x72,0x46,0xFB,0x36,0x4D,0x6F,0xA9,0x6B,0x71,0xD3,0x26,0x7A},
+{0xED,0x21,0x59,0x85,0x61,0x75,0xA4,0x84,0x2C,0x93,0xF3,0x6C,0x44,0x85,0x87,0xC2,
+ 0x4D,0xC2,0x87,0x85,0x44,0x6C,0xF3,0x93,0x2C,0x84,0xA4,0x75,0x61,0x85,0x59,0x21},
+{0xEE,0xCC,0xD8,0x7F,0x51,0x57,0xB3,0x3E,0x8F,0xFB,0xEB,0x12,0x1E,0x7F,0xFD,0xA2,
+ 0xDE,0xA2,0xFD,0x7F,0x1E,0x12,0xEB,0xFB,0x8F,0x3E,0xB3,0x57,0x51,0x7F,0xD8,0xCC},
+{0xEF,0x97,0xA7,0x29,0x41,0x49,0xBE,0xD5,0xEE,0x5E,0xE3,0x38,0x28,0x29,0x56,0x82,
+ 0xAF,0x82,0x56,0x29,0x28,0x38,0xE3,0x5E,0xEE,0xD5,0xBE,0x49,0x41,0x29,0xA7,0x97},
+{0xF0,0x62,0xC0,0x47,0x36,0x84,0x25,0x0F,0x44,0x65,0x1B,0x10,0xF3,0x47,0xD7,0x6C,
+ 0x72,0x6C,0xD7,0x47,0xF3,0x10,0x1B,0x65,0x44,0x0F,0x25,0x84,0x36,0x47,0xC0,0x62},
+{0xF1,0x39,0xBF,0x11,0x26,0x9A,0x28,0xE4,0x25,0xC0,0x13,0x3A,0xC5,0x11,0x7C,0x4C,
+ 0x03,0x4C,0x7C,0x11,0xC5,0x3A,0x13,0xC0,0x25,0xE4,0x28,0x9A,0x26,0x11,0xBF,0x39},
+{0xF2,0xD4,0x3E,0xEB,0x16,0xB8,0x3F,0x5E,0x86,0xA8,0x0B,0x44,0x9F,0xEB,0x06,0x2C,
+ 0x90,0x2C,0x06,0xEB,0x9F,0x44,0x0B,0xA8,0x86,0x5E,0x3F,0xB8,0x16,0xEB,0x3E,0xD4},
+{0xF3,0x8F,0x41,0xBD,0x06,0xA6,0x32,0xB5,0xE7,0x0D,0x03,0x6E,0xA9,0xBD,0xAD,0x0C,
+ 0xE1,0x0C,0xAD,0xBD,0xA9,0x6E,0x03,0x0D,0xE7,0xB5,0x32,0xA6,0x06,0xBD,0x41,0x8F},
+{0xF4,0x89,0xBB,0x98,0x76,0xFC,0x11,0xAD,0x47,0x78,0x3B,0xB8,0x2B,0x98,0xF2,0xEC,
+ 0x31,0xEC,0xF2,0x98,0x2B,0xB8,0x3B,0x78,0x47,0xAD,0x11,0xFC,0x76,0x98,0xBB,0x89},
+{0xF5,0xD2,0xC4,0xCE,0x66,0xE2,0x1C,0x46,0x26,0xDD,0x33,0x92,0x1D,0xCE,0x59,0xCC,
+ 0x40,0xCC,0x59,0xCE,0x1D,0x92,0x33,0xDD,0x26,0x46,0x1C,0xE2,0x66,0xCE,0xC4,0xD2},
+{0xF6,0x3F,0x45,0x34,0x56,0xC0,0x0B,0xFC,0x85,0xB5,0x2B,0xEC,0x47,0x34,0x23,0xAC,
+ 0xD3,0xAC,0x23,0x34,0x47,0xEC,0x2B,0xB5,0x85,0xFC,0x0B,0xC0,0x56,0x34,0x45,0x3F},
+{0xF7,0x64,0x3A,0x62,0x46,0xDE,0x06,0x17,0xE4,0x10,0x23,0xC6,0x71,0x62,0x88,0x8C,
+ 0xA2,0x8C,0x88,0x62,0x71,0xC6,0x23,0x10,0xE4,0x17,0x06,0xDE,0x46,0x62,0x3A,0x64},
+{0xF8,0x33,0x36,0x7E,0xB6,0x74,0x4D,0xCC,0x42,0x5F,0x5B,0xC7,0xC4,0x7E,0x9D,0xEB,
+ 0xF4,0xEB,0x9D,0x7E,0xC4,0xC7,0x5B,0x5F,0x42,0xCC,0x4D,0x74,0xB6,0x7E,0x36,0x33},
+{0xF9,0x68,0x49,0x28,0xA6,0x6A,0x40,0x27,0x23,0xFA,0x53,0xED,0xF2,0x28,0x36,0xCB,
+ 0x85,0xCB,0x36,0x28,0xF2,0xED,0x53,0xFA,0x23,0x27,0x40,0x6A,0xA6,0x28,0x49,0x68},
+{0xFA,0x85,0xC8,0xD2,0x96,0x48,0x57,0x9D,0x80,0x92,0x4B,0x93,0xA8,0xD2,0x4C,0xAB,
+ 0x16,0xAB,0x4C,0xD2,0xA8,0x93,0x4B,0x92,0x80,0x9D,0x57,0x48,0x96,0xD2,0xC8,0x85},
+{0xFB,0xDE,0xB7,0x84,0x86,0x56,0x5A,0x76,0xE1,0x37,0x43,0xB9,0x9E,0x84,0xE7,0x8B,
+ 0x67,0x8B,0xE7,0x84,0x9E,0xB9,0x43,0x37,0xE1,0x76,0x5A,0x56,0x86,0x84,0xB7,0xDE},
+{0xFC,0xD8,0x4D,0xA1,0xF6,0x0C,0x79,0x6E,0x41,0x42,0x7B,0x6F,0x1C,0xA1,0xB8,0x6B,
+ 0xB7,0x6B,0xB8,0xA1,0x1C,0x6F,0x7B,0x42,0x41,0x6E,0x79,0x0C,0xF6,0xA1,0x4D,0xD8},
+{0xFD,0x83,0x32,0xF7,0xE6,0x12,0x74,0x85,0x20,0xE7,0x73,0x45,0x2A,0xF7,0x13,0x4B,
+ 0xC6,0x4B,0x13,0xF7,0x2A,0x45,0x73,0xE7,0x20,0x85,0x74,0x12,0xE6,0xF7,0x32,0x83},
+{0xFE,0x6E,0xB3,0x0D,0xD6,0x30,0x63,0x3F,0x83,0x8F,0x6B,0x3B,0x70,0x0D,0x69,0x2B,
+ 0x55,0x2B,0x69,0x0D,0x70,0x3B,0x6B,0x8F,0x83,0x3F,0x63,0x30,0xD6,0x0D,0xB3,0x6E},
+{0xFF,0x35,0xCC,0x5B,0xC6,0x2E,0x6E,0xD4,0xE2,0x2A,0x63,0x11,0x46,0x5B,0xC2,0x0B,
+ 0x24,0x0B,0xC2,0x5B,0x46,0x11,0x63,0x2A,0xE2,0xD4,0x6E,0x2E,0xC6,0x5B,0xCC,0x35},
+};
+
+/* Multiplication by the roots of g(x), SYNMUL[i][x] = x * alpha^((FCR + i) * PRIM) */
+static const uint8_t SYNMUL[32][256] = {
+{0x00,0x15,0x2A,0x3F,0x54,0x41,0x7E,0x6B,0xA8,0xBD,0x82,0x97,0xFC,0xE9,0xD6,0xC3,
+ 0xD7,0xC2,0xFD,0xE8,0x83,0x96,0xA9,0xBC,0x7F,0x6A,0x55,0x40,0x2B,0x3E,0x01,0x14,
+ 0x29,0x3C,0x03,0x16,0x7D,0x68,0x57,0x42,0x81,0x94,0xAB,0xBE,0xD5,0xC0,0xFF,0xEA,
+ 0xFE,0xEB,0xD4,0xC1,0xAA,0xBF,0x80,0x95,0x56,0x43,0x7C,0x69,0x02,0x17,0x28,0x3D,
+ 0x52,0x47,0x78,0x6D,0x06,0x13,0x2C,0x39,0xFA,0xEF,0xD0,0xC5,0xAE,0xBB,0x84,0x91,
+ 0x85,0x90,0xAF,0xBA,0xD1,0xC4,0xFB,0xEE,0x2D,0x38,0x07,0x12,0x79,0x6C,0x53,0x46,
+ 0x7B,0x6E,0x51,0x44,0x2F,0x3A,0x05,0x10,0xD3,0xC6,0xF9,0xEC,0x87,0x92,0xAD,0xB8,
+ 0xAC,0xB9,0x86,0x93,0xF8,0xED,0xD2,0xC7,0x04,0x11,0x2E,0x3B,0x50,0x45,0x7A,0x6F,
+ 0xA4,0xB1,0x8E,0x9B,0xF0,0xE5,0xDA,0xCF,0x0C,0x19,0x26,0x33,0x58,0x4D,0x72,0x67,
+ 0x73,0x66,0x59,0x4C,0x27,0x32,0x0D,0x18,0xDB,0xCE,0xF1,0xE4,0x8F,0x9A,0xA5,0xB0,
+ 0x8D,0x98,0xA7,0xB2,0xD9,0xCC,0xF3,0xE6,0x25,0x30,0x0F,0x1A,0x71,0x64,0x5B,0x4E,
+ 0x5A,0x4F,0x70,0x65,0x0E,0x1B,0x24,0x31,0xF2,0xE7,0xD8,0xCD,0xA6,0xB3,0x8C,0x99,
+ 0xF6,0xE3,0xDC,0xC9,0xA2,0xB7,0x88,0x9D,0x5E,0x4B,0x74,0x61,0x0A,0x1F,0x20,0x35,
+ 0x21,0x34,0x0B,0x1E,0x75,0x60,0x5F,0x4A,0x89,0x9C,0xA3,0xB6,0xDD,0xC8,0xF7,0xE2,
+ 0xDF,0xCA,0xF5,0xE0,0x8B,0x9E,0xA1,0xB4,0x77,0x62,0x5D,0x48,0x23,0x36,0x09,0x1C,
+ 0x08,0x1D,0x22,0x37,0x5C,0x49,0x76,0x63,0xA0,0xB5,0x8A,0x9F,0xF4,0xE1,0xDE,0xCB},
+{0x00,0x64,0xC8,0xAC,0x17,0x73,0xDF,0xBB,0x2E,0x4A,0xE6,0x82,0x39,0x5D,0xF1,0x95,
+ 0x5C,0x38,0x94,0xF0,0x4B,0x2F,0x83,0xE7,0x72,0x16,0xBA,0xDE,0x65,0x01,0xAD,0xC9,
+ 0xB8,0xDC,0x70,0x14,0xAF,0xCB,0x67,0x03,0x96,0xF2,0x5E,0x3A,0x81,0xE5,0x49,0x2D,
+ 0xE4,0x80,0x2C,0x48,0xF3,0x97,0x3B,0x5F,0xCA,0xAE,0x02,0x66,0xDD,0xB9,0x15,0x71,
+ 0xF7,0x93,0x3F,0x5B,0xE0,0x84,0x28,0x4C,0xD9,0xBD,0x11,0x75,0xCE,0xAA,0x06,0x62,
+ 0xAB,0xCF,0x63,0x07,0xBC,0xD8,0x74,0x10,0x85,0xE1,0x4D,0x29,0x92,0xF6,0x5A,0x3E,
+ 0x4F,0x2B,0x87,0xE3,0x58,0x3C,0x90,0xF4,0x61,0x05,0xA9,0xCD,0x76,0x12,0xBE,0xDA,
+ 0x13,0x77,0xDB,0xBF,0x04,0x60,0xCC,0xA8,0x3D,0x59,0xF5,0x91,0x2A,0x4E,0xE2,0x86,
+ 0x69,0x0D,0xA1,0xC5,0x7E,0x1A,0xB6,0xD2,0x47,0x23,0x8F,0xEB,0x50,0x34,0x98,0xFC,
+ 0x35,0x51,0xFD,0x99,0x22,0x46,0xEA,0x8E,0x1B,0x7F,0xD3,0xB7,0x0C,0x68,0xC4,0xA0,
+ 0xD1,0xB5,0x19,0x7D,0xC6,0xA2,0x0E,0x6A,0xFF,0x9B,0x37,0x53,0xE8,0x8C,0x20,0x44,
+ 0x8D,0xE9,0x45,0x21,0x9A,0xFE,0x52,0x36,0xA3,0xC7,0x6B,0x0F,0xB4,0xD0,0x7C,0x18,
+ 0x9E,0xFA,0x56,0x32,0x89,0xED,0x41,0x25,0xB0,0xD4,0x78,0x1C,0xA7,0xC3,0x6F,0x0B,
+ 0xC2,0xA6,0x0A,0x6E,0xD5,0xB1,0x1D,0x79,0xEC,0x88,0x24,0x40,0xFB,0x9F,0x33,0x57,
+ 0x26,0x42,0xEE,0x8A,0x31,0x55,0xF9,0x9D,0x08,0x6C,0xC0,0xA4,0x1F,0x7B,0xD7,0xB3,
+ 0x7A,0x1E,0xB2,0xD6,0x6D,0x09,0xA5,0xC1,0x54,0x30,0x9C,0xF8,0x43,0x27,0x8B,0xEF},
+{0x00,0x8C,0x9F,0x13,0xB9,0x35,0x26,0xAA,0xF5,0x79,0x6A,0xE6,0x4C,0xC0,0xD3,0x5F,
+ 0x6D,0xE1,0xF2,0x7E,0xD4,0x58,0x4B,0xC7,0x98,0x14,0x07,0x8B,0x21,0xAD,0xBE,0x32,
+ 0xDA,0x56,0x45,0xC9,0x63,0xEF,0xFC,0x70,0x2F,0xA3,0xB0,0x3C,0x96,0x1A,0x09,0x85,
+ 0xB7,0x3B,0x28,0xA4,0x0E,0x82,0x91,0x1D,0x42,0xCE,0xDD,0x51,0xFB,0x77,0x64,0xE8,
+ 0x33,0xBF,0xAC,0x20,0x8A,0x06,0x15,0x99,0xC6,0x4A,0x59,0xD5,0x7F,0xF3,0xE0,0x6C,
+ 0x5E,0xD2,0xC1,0x4D,0xE7,0x6B,0x78,0xF4,0xAB,0x27,0x34,0xB8,0x12,0x9E,0x8D,0x01,
+ 0xE9,0x65,0x76,0xFA,0x50,0xDC,0xCF,0x43,0x1C,0x90,0x83,0x0F,0xA5,0x29,0x3A,0xB6,
+ 0x84,0x08,0x1B,0x97,0x3D,0xB1,0xA2,0x2E,0x71,0xFD,0xEE,0x62,0xC8,0x44,0x57,0xDB,
+ 0x66,0xEA,0xF9,0x75,0xDF,0x53,0x40,0xCC,0x93,0x1F,0x0C,0x80,0x2A,0xA6,0xB5,0x39,
+ 0x0B,0x87,0x94,0x18,0xB2,0x3E,0x2D,0xA1,0xFE,0x72,0x61,0xED,0x47,0xCB,0xD8,0x54,
+ 0xBC,0x30,0x23,0xAF,0x05,0x89,0x9A,0x16,0x49,0xC5,0xD6,0x5A,0xF0,0x7C,0x6F,0xE3,
+ 0xD1,0x5D,0x4E,0xC2,0x68,0xE4,0xF7,0x7B,0x24,0xA8,0xBB,0x37,0x9D,0x11,0x02,0x8E,
+ 0x55,0xD9,0xCA,0x46,0xEC,0x60,0x73,0xFF,0xA0,0x2C,0x3F,0xB3,0x19,0x95,0x86,0x0A,
+ 0x38,0xB4,0xA7,0x2B,0x81,0x0D,0x1E,0x92,0xCD,0x41,0x52,0xDE,0x74,0xF8,0xEB,0x67,
+ 0x8F,0x03,0x10,0x9C,0x36,0xBA,0xA9,0x25,0x7A,0xF6,0xE5,0x69,0xC3,0x4F,0x5C,0xD0,
+ 0xE2,0x6E,0x7D,0xF1,0x5B,0xD7,0xC4,0x48,0x17,0x9B,0x88,0x04,0xAE,0x22,0x31,0xBD},
+{0x00,0x7C,0xF8,0x84,0x77,0x0B,0x8F,0xF3,0xEE,0x92,0x16,0x6A,0x99,0xE5,0x61,0x1D,
+ 0x5B,0x27,0xA3,0xDF,0x2C,0x50,0xD4,0xA8,0xB5,0xC9,0x4D,0x31,0xC2,0xBE,0x3A,0x46,
+ 0xB6,0xCA,0x4E,0x32,0xC1,0xBD,0x39,0x45,0x58,0x24,0xA0,0xDC,0x2F,0x53,0xD7,0xAB,
+ 0xED,0x91,0x15,0x69,0x9A,0xE6,0x62,0x1E,0x03,0x7F,0xFB,0x87,0x74,0x08,0x8C,0xF0,
+ 0xEB,0x97,0x13,0x6F,0x9C,0xE0,0x64,0x18,0x05,0x79,0xFD,0x81,0x72,0x0E,0x8A,0xF6,
+ 0xB0,0xCC,0x48,0x34,0xC7,0xBB,0x3F,0x43,0x5E,0x22,0xA6,0xDA,0x29,0x55,0xD1,0xAD,
+ 0x5D,0x21,0xA5,0xD9,0x2A,0x56,0xD2,0xAE,0xB3,0xCF,0x4B,0x37,0xC4,0xB8,0x3C,0x40,
+ 0x06,0x7A,0xFE,0x82,0x71,0x0D,0x89,0xF5,0xE8,0x94,0x10,0x6C,0x9F,0xE3,0x67,0x1B,
+ 0x51,0x2D,0xA9,0xD5,0x26,0x5A,0xDE,0xA2,0xBF,0xC3,0x47,0x3B,0xC8,0xB4,0x30,0x4C,
+ 0x0A,0x76,0xF2,0x8E,0x7D,0x01,0x85,0xF9,0xE4,0x98,0x1C,0x60,0x93,0xEF,0x6B,0x17,
+ 0xE7,0x9B,0x1F,0x63,0x90,0xEC,0x68,0x14,0x09,0x75,0xF1,0x8D,0x7E,0x02,0x86,0xFA,
+ 0xBC,0xC0,0x44,0x38,0xCB,0xB7,0x33,0x4F,0x52,0x2E,0xAA,0xD6,0x25,0x59,0xDD,0xA1,
+ 0xBA,0xC6,0x42,0x3E,0xCD,0xB1,0x35,0x49,0x54,0x28,0xAC,0xD0,0x23,0x5F,0xDB,0xA7,
+ 0xE1,0x9D,0x19,0x65,0x96,0xEA,0x6E,0x12,0x0F,0x73,0xF7,0x8B,0x78,0x04,0x80,0xFC,
+ 0x0C,0x70,0xF4,0x88,0x7B,0x07,0x83,0xFF,0xE2,0x9E,0x1A,0x66,0x95,0xE9,0x6D,0x11,
+ 0x57,0x2B,0xAF,0xD3,0x20,0x5C,0xD8,0xA4,0xB9,0xC5,0x41,0x3D,0xCE,0xB2,0x36,0x4A},
+{0x00,0x02,0x04,0x06,0x08,0x0A,0x0C,0x0E,0x10,0x12,0x14,0x16,0x18,0x1A,0x1C,0x1E,
+ 0x20,0x22,0x24,0x26,0x28,0x2A,0x2C,0x2E,0x30,0x32,0x34,0x36,0x38,0x3A,0x3C,0x3E,
+ 0x40,0x42,0x44,0x46,0x48,0x4A,0x4C,0x4E,0x50,0x52,0x54,0x56,0x58,0x5A,0x5C,0x5E,
+ 0x60,0x62,0x64,0x66,0x68,0x6A,0x6C,0x6E,0x70,0x72,0x74,0x76,0x78,0x7A,0x7C,0x7E,
+ 0x80,0x82,0x84,0x86,0x88,0x8A,0x8C,0x8E,0x90,0x92,0x94,0x96,0x98,0x9A,0x9C,0x9E,
+ 0xA0,0xA2,0xA4,0xA6,0xA8,0xAA,0xAC,0xAE,0xB0,0xB2,0xB4,0xB6,0xB8,0xBA,0xBC,0xBE,
+ 0xC0,0xC2,0xC4,0xC6,0xC8,0xCA,0xCC,0xCE,0xD0,0xD2,0xD4,0xD6,0xD8,0xDA,0xDC,0xDE,
+ 0xE0,0xE2,0xE4,0xE6,0xE8,0xEA,0xEC,0xEE,0xF0,0xF2,0xF4,0xF6,0xF8,0xFA,0xFC,0xFE,
+ 0x87,0x85,0x83,0x81,0x8F,0x8D,0x8B,0x89,0x97,0x95,0x93,0x91,0x9F,0x9D,0x9B,0x99,
+ 0xA7,0xA5,0xA3,0xA1,0xAF,0xAD,0xAB,0xA9,0xB7,0xB5,0xB3,0xB1,0xBF,0xBD,0xBB,0xB9,
+ 0xC7,0xC5,0xC3,0xC1,0xCF,0xCD,0xCB,0xC9,0xD7,0xD5,0xD3,0xD1,0xDF,0xDD,0xDB,0xD9,
+ 0xE7,0xE5,0xE3,0xE1,0xEF,0xED,0xEB,0xE9,0xF7,0xF5,0xF3,0xF1,0xFF,0xFD,0xFB,0xF9,
+ 0x07,0x05,0x03,0x01,0x0F,0x0D,0x0B,0x09,0x17,0x15,0x13,0x11,0x1F,0x1D,0x1B,0x19,
+ 0x27,0x25,0x23,0x21,0x2F,0x2D,0x2B,0x29,0x37,0x35,0x33,0x31,0x3F,0x3D,0x3B,0x39,
+ 0x47,0x45,0x43,0x41,0x4F,0x4D,0x4B,0x49,0x57,0x55,0x53,0x51,0x5F,0x5D,0x5B,0x59,
+ 0x67,0x65,0x63,0x61,0x6F,0x6D,0x6B,0x69,0x77,0x75,0x73,0x71,0x7F,0x7D,0x7B,0x79},
+{0x00,0xDD,0x3D,0xE0,0x7A,0xA7,0x47,0x9A,0xF4,0x29,0xC9,0x14,0x8E,0x53,0xB3,0x6E,
+ 0x6F,0xB2,0x52,0x8F,0x15,0xC8,0x28,0xF5,0x9B,0x46,0xA6,0x7B,0xE1,0x3C,0xDC,0x01,
+ 0xDE,0x03,0xE3,0x3E,0xA4,0x79,0x99,0x44,0x2A,0xF7,0x17,0xCA,0x50,0x8D,0x6D,0xB0,
+ 0xB1,0x6C,0x8C,0x51,0xCB,0x16,0xF6,0x2B,0x45,0x98,0x78,0xA5,0x3F,0xE2,0x02,0xDF,
+ 0x3B,0xE6,0x06,0xDB,0x41,0x9C,0x7C,0xA1,0xCF,0x12,0xF2,0x2F,0xB5,0x68,0x88,0x55,
+ 0x54,0x89,0x69,0xB4,0x2E,0xF3,0x13,0xCE,0xA0,0x7D,0x9D,0x40,0xDA,0x07,0xE7,0x3A,
+ 0xE5,0x38,0xD8,0x05,0x9F,0x42,0xA2,0x7F,0x11,0xCC,0x2C,0xF1,0x6B,0xB6,0x56,0x8B,
+ 0x8A,0x57,0xB7,0x6A,0xF0,0x2D,0xCD,0x10,0x7E,0xA3,0x43,0x9E,0x04,0xD9,0x39,0xE4,
+ 0x76,0xAB,0x4B,0x96,0x0C,0xD1,0x31,0xEC,0x82,0x5F,0xBF,0x62,0xF8,0x25,0xC5,0x18,
+ 0x19,0xC4,0x24,0xF9,0x63,0xBE,0x5E,0x83,0xED,0x30,0xD0,0x0D,0x97,0x4A,0xAA,0x77,
+ 0xA8,0x75,0x95,0x48,0xD2,0x0F,0xEF,0x32,0x5C,0x81,0x61,0xBC,0x26,0xFB,0x1B,0xC6,
+ 0xC7,0x1A,0xFA,0x27,0xBD,0x60,0x80,0x5D,0x33,0xEE,0x0E,0xD3,0x49,0x94,0x74,0xA9,
+ 0x4D,0x90,0x70,0xAD,0x37,0xEA,0x0A,0xD7,0xB9,0x64,0x84,0x59,0xC3,0x1E,0xFE,0x23,
+ 0x22,0xFF,0x1F,0xC2,0x58,0x85,0x65,0xB8,0xD6,0x0B,0xEB,0x36,0xAC,0x71,0x91,0x4C,
+ 0x93,0x4E,0xAE,0x73,0xE9,0x34,0xD4,0x09,0x67,0xBA,0x5A,0x87,0x1D,0xC0,0x20,0xFD,
+ 0xFC,0x21,0xC1,0x1C,0x86,0x5B,0xBB,0x66,0x08,0xD5,0x35,0xE8,0x72,0xAF,0x4F,0x92},
+{0x00,0xFB,0x71,0x8A,0xE2,0x19,0x93,0x68,0x43,0xB8,0x32,0xC9,0xA1,0x5A,0xD0,0x2B,
+ 0x86,0x7D,0xF7,0x0C,0x64,0x9F,0x15,0xEE,0xC5,0x3E,0xB4,0x4F,0x27,0xDC,0x56,0xAD,
+ 0x8B,0x70,0xFA,0x01,0x69,0x92,0x18,0xE3,0xC8,0x33,0xB9,0x42,0x2A,0xD1,0x5B,0xA0,
+ 0x0D,0xF6,0x7C,0x87,0xEF,0x14,0x9E,0x65,0x4E,0xB5,0x3F,0xC4,0xAC,0x57,0xDD,0x26,
+ 0x91,0x6A,0xE0,0x1B,0x73,0x88,0x02,0xF9,0xD2,0x29,0xA3,0x58,0x30,0xCB,0x41,0xBA,
+ 0x17,0xEC,0x66,0x9D,0xF5,0x0E,0x84,0x7F,0x54,0xAF,0x25,0xDE,0xB6,0x4D,0xC7,0x3C,
+ 0x1A,0xE1,0x6B,0x90,0xF8,0x03,0x89,0x72,0x59,0xA2,0x28,0xD3,0xBB,0x40,0xCA,0x31,
+ 0x9C,0x67,0xED,0x16,0x7E,0x85,0x0F,0xF4,0xDF,0x24,0xAE,0x55,0x3D,0xC6,0x4C,0xB7,
+ 0xA5,0x5E,0xD4,0x2F,0x47,0xBC,0x36,0xCD,0xE6,0x1D,0x97,0x6C,0x04,0xFF,0x75,0x8E,
+ 0x23,0xD8,0x52,0xA9,0xC1,0x3A,0xB0,0x4B,0x60,0x9B,0x11,0xEA,0x82,0x79,0xF3,0x08,
+ 0x2E,0xD5,0x5F,0xA4,0xCC,0x37,0xBD,0x46,0x6D,0x96,0x1C,0xE7,0x8F,0x74,0xFE,0x05,
+ 0xA8,0x53,0xD9,0x22,0x4A,0xB1,0x3B,0xC0,0xEB,0x10,0x9A,0x61,0x09,0xF2,0x78,0x83,
+ 0x34,0xCF,0x45,0xBE,0xD6,0x2D,0xA7,0x5C,0x77,0x8C,0x06,0xFD,0x95,0x6E,0xE4,0x1F,
+ 0xB2,0x49,0xC3,0x38,0x50,0xAB,0x21,0xDA,0xF1,0x0A,0x80,0x7B,0x13,0xE8,0x62,0x99,
+ 0xBF,0x44,0xCE,0x35,0x5D,0xA6,0x2C,0xD7,0xFC,0x07,0x8D,0x76,0x1E,0xE5,0x6F,0x94,
+ 0x39,0xC2,0x48,0xB3,0xDB,0x20,0xAA,0x51,0x7A,0x81,0x0B,0xF0,0x98,0x63,0xE9,0x12},
+{0x00,0x74,0xE8,0x9C,0x57,0x23,0xBF,0xCB,0xAE,0xDA,0x46,0x32,0xF9,0x8D,0x11,0x65,
+ 0xDB,0xAF,0x33,0x47,0x8C,0xF8,0x64,0x10,0x75,0x01,0x9D,0xE9,0x22,0x56,0xCA,0xBE,
+ 0x31,0x45,0xD9,0xAD,0x66,0x12,0x8E,0xFA,0x9F,0xEB,0x77,0x03,0xC8,0xBC,0x20,0x54,
+ 0xEA,0x9E,0x02,0x76,0xBD,0xC9,0x55,0x21,0x44,0x30,0xAC,0xD8,0x13,0x67,0xFB,0x8F,
+ 0x62,0x16,0x8A,0xFE,0x35,0x41,0xDD,0xA9,0xCC,0xB8,0x24,0x50,0x9B,0xEF,0x73,0x07,
+ 0xB9,0xCD,0x51,0x25,0xEE,0x9A,0x06,0x72,0x17,0x63,0xFF,0x8B,0x40,0x34,0xA8,0xDC,
+ 0x53,0x27,0xBB,0xCF,0x04,0x70,0xEC,0x98,0xFD,0x89,0x15,0x61,0xAA,0xDE,0x42,0x36,
+ 0x88,0xFC,0x60,0x14,0xDF,0xAB,0x37,0x43,0x26,0x52,0xCE,0xBA,0x71,0x05,0x99,0xED,
+ 0xC4,0xB0,0x2C,0x58,0x93,0xE7,0x7B,0x0F,0x6A,0x1E,0x82,0xF6,0x3D,0x49,0xD5,0xA1,
+ 0x1F,0x6B,0xF7,0x83,0x48,0x3C,0xA0,0xD4,0xB1,0xC5,0x59,0x2D,0xE6,0x92,0x0E,0x7A,
+ 0xF5,0x81,0x1D,0x69,0xA2,0xD6,0x4A,0x3E,0x5B,0x2F,0xB3,0xC7,0x0C,0x78,0xE4,0x90,
+ 0x2E,0x5A,0xC6,0xB2,0x79,0x0D,0x91,0xE5,0x80,0xF4,0x68,0x1C,0xD7,0xA3,0x3F,0x4B,
+ 0xA6,0xD2,0x4E,0x3A,0xF1,0x85,0x19,0x6D,0x08,0x7C,0xE0,0x94,0x5F,0x2B,0xB7,0xC3,
+ 0x7D,0x09,0x95,0xE1,0x2A,0x5E,0xC2,0xB6,0xD3,0xA7,0x3B,0x4F,0x84,0xF0,0x6C,0x18,
+ 0x97,0xE3,0x7F,0x0B,0xC0,0xB4,0x28,0x5C,0x39,0x4D,0xD1,0xA5,0x6E,0x1A,0x86,0xF2,
+ 0x4C,0x38,0xA4,0xD0,0x1B,0x6F,0xF3,0x87,0xE2,0x96,0x0A,0x7E,0xB5,0xC1,0x5D,0x29},
+{0x00,0x78,0xF0,0x88,0x67,0x1F,0x97,0xEF,0xCE,0xB6,0x3E,0x46,0xA9,0xD1,0x59,0x21,
+ 0x1B,0x63,0xEB,0x93,0x7C,0x04,0x8C,0xF4,0xD5,0xAD,0x25,0x5D,0xB2,0xCA,0x42,0x3A,
+ 0x36,0x4E,0xC6,0xBE,0x51,0x29,0xA1,0xD9,0xF8,0x80,0x08,0x70,0x9F,0xE7,0x6F,0x17,
+ 0x2D,0x55,0xDD,0xA5,0x4A,0x32,0xBA,0xC2,0xE3,0x9B,0x13,0x6B,0x84,0xFC,0x74,0x0C,
+ 0x6C,0x14,0x9C,0xE4,0x0B,0x73,0xFB,0x83,0xA2,0xDA,0x52,0x2A,0xC5,0xBD,0x35,0x4D,
+ 0x77,0x0F,0x87,0xFF,0x10,0x68,0xE0,0x98,0xB9,0xC1,0x49,0x31,0xDE,0xA6,0x2E,0x56,
+ 0x5A,0x22,0xAA,0xD2,0x3D,0x45,0xCD,0xB5,0x94,0xEC,0x64,0x1C,0xF3,0x8B,0x03,0x7B,
+ 0x41,0x39,0xB1,0xC9,0x26,0x5E,0xD6,0xAE,0x8F,0xF7,0x7F,0x07,0xE8,0x90,0x18,0x60,
+ 0xD8,0xA0,0x28,0x50,0xBF,0xC7,0x4F,0x37,0x16,0x6E,0xE6,0x9E,0x71,0x09,0x81,0xF9,
+ 0xC3,0xBB,0x33,0x4B,0xA4,0xDC,0x54,0x2C,0x0D,0x75,0xFD,0x85,0x6A,0x12,0x9A,0xE2,
+ 0xEE,0x96,0x1E,0x66,0x89,0xF1,0x79,0x01,0x20,0x58,0xD0,0xA8,0x47,0x3F,0xB7,0xCF,
+ 0xF5,0x8D,0x05,0x7D,0x92,0xEA,0x62,0x1A,0x3B,0x43,0xCB,0xB3,0x5C,0x24,0xAC,0xD4,
+ 0xB4,0xCC,0x44,0x3C,0xD3,0xAB,0x23,0x5B,0x7A,0x02,0x8A,0xF2,0x1D,0x65,0xED,0x95,
+ 0xAF,0xD7,0x5F,0x27,0xC8,0xB0,0x38,0x40,0x61,0x19,0x91,0xE9,0x06,0x7E,0xF6,0x8E,
+ 0x82,0xFA,0x72,0x0A,0xE5,0x9D,0x15,0x6D,0x4C,0x34,0xBC,0xC4,0x2B,0x53,0xDB,0xA3,
+ 0x99,0xE1,0x69,0x11,0xFE,0x86,0x0E,0x76,0x57,0x2F,0xA7,0xDF,0x30,0x48,0xC0,0xB8},
+{0x00,0x3F,0x7E,0x41,0xFC,0xC3,0x82,0xBD,0x7F,0x40,0x01,0x3E,0x83,0xBC,0xFD,0xC2,
+ 0xFE,0xC1,0x80,0xBF,0x02,0x3D,0x7C,0x43,0x81,0xBE,0xFF,0xC0,0x7D,0x42,0x03,0x3C,
+ 0x7B,0x44,0x05,0x3A,0x87,0xB8,0xF9,0xC6,0x04,0x3B,0x7A,0x45,0xF8,0xC7,0x86,0xB9,
+ 0x85,0xBA,0xFB,0xC4,0x79,0x46,0x07,0x38,0xFA,0xC5,0x84,0xBB,0x06,0x39,0x78,0x47,
+ 0xF6,0xC9,0x88,0xB7,0x0A,0x35,0x74,0x4B,0x89,0xB6,0xF7,0xC8,0x75,0x4A,0x0B,0x34,
+ 0x08,0x37,0x76,0x49,0xF4,0xCB,0x8A,0xB5,0x77,0x48,0x09,0x36,0x8B,0xB4,0xF5,0xCA,
+ 0x8D,0xB2,0xF3,0xCC,0x71,0x4E,0x0F,0x30,0xF2,0xCD,0x8C,0xB3,0x0E,0x31,0x70,0x4F,
+ 0x73,0x4C,0x0D,0x32,0x8F,0xB0,0xF1,0xCE,0x0C,0x33,0x72,0x4D,0xF0,0xCF,0x8E,0xB1,
+ 0x6B,0x54,0x15,0x2A,0x97,0xA8,0xE9,0xD6,0x14,0x2B,0x6A,0x55,0xE8,0xD7,0x96,0xA9,
+ 0x95,0xAA,0xEB,0xD4,0x69,0x56,0x17,0x28,0xEA,0xD5,0x94,0xAB,0x16,0x29,0x68,0x57,
+ 0x10,0x2F,0x6E,0x51,0xEC,0xD3,0x92,0xAD,0x6F,0x50,0x11,0x2E,0x93,0xAC,0xED,0xD2,
+ 0xEE,0xD1,0x90,0xAF,0x12,0x2D,0x6C,0x53,0x91,0xAE,0xEF,0xD0,0x6D,0x52,0x13,0x2C,
+ 0x9D,0xA2,0xE3,0xDC,0x61,0x5E,0x1F,0x20,0xE2,0xDD,0x9C,0xA3,0x1E,0x21,0x60,0x5F,
+ 0x63,0x5C,0x1D,0x22,0x9F,0xA0,0xE1,0xDE,0x1C,0x23,0x62,0x5D,0xE0,0xDF,0x9E,0xA1,
+ 0xE6,0xD9,0x98,0xA7,0x1A,0x25,0x64,0x5B,0x99,0xA6,0xE7,0xD8,0x65,0x5A,0x1B,0x24,
+ 0x18,0x27,0x66,0x59,0xE4,0xDB,0x9A,0xA5,0x67,0x58,0x19,0x26,0x9B,0xA4,0xE5,0xDA},
+{0x00,0xAC,0xDF,0x73,0x39,0x95,0xE6,0x4A,0x72,0xDE,0xAD,0x01,0x4B,0xE7,0x94,0x38,
+ 0xE4,0x48,0x3B,0x97,0xDD,0x71,0x02,0xAE,0x96,0x3A,0x49,0xE5,0xAF,0x03,0x70,0xDC,
+ 0x4F,0xE3,0x90,0x3C,0x76,0xDA,0xA9,0x05,0x3D,0x91,0xE2,0x4E,0x04,0xA8,0xDB,0x77,
+ 0xAB,0x07,0x74,0xD8,0x92,0x3E,0x4D,0xE1,0xD9,0x75,0x06,0xAA,0xE0,0x4C,0x3F,0x93,
+ 0x9E,0x32,0x41,0xED,0xA7,0x0B,0x78,0xD4,0xEC,0x40,0x33,0x9F,0xD5,0x79,0x0A,0xA6,
+ 0x7A,0xD6,0xA5,0x09,0x43,0xEF,0x9C,0x30,0x08,0xA4,0xD7,0x7B,0x31,0x9D,0xEE,0x42,
+ 0xD1,0x7D,0x0E,0xA2,0xE8,0x44,0x37,0x9B,0xA3,0x0F,0x7C,0xD0,0x9A,0x36,0x45,0xE9,
+ 0x35,0x99,0xEA,0x46,0x0C,0xA0,0xD3,0x7F,0x47,0xEB,0x98,0x34,0x7E,0xD2,0xA1,0x0D,
+ 0xBB,0x17,0x64,0xC8,0x82,0x2E,0x5D,0xF1,0xC9,0x65,0x16,0xBA,0xF0,0x5C,0x2F,0x83,
+ 0x5F,0xF3,0x80,0x2C,0x66,0xCA,0xB9,0x15,0x2D,0x81,0xF2,0x5E,0x14,0xB8,0xCB,0x67,
+ 0xF4,0x58,0x2B,0x87,0xCD,0x61,0x12,0xBE,0x86,0x2A,0x59,0xF5,0xBF,0x13,0x60,0xCC,
+ 0x10,0xBC,0xCF,0x63,0x29,0x85,0xF6,0x5A,0x62,0xCE,0xBD,0x11,0x5B,0xF7,0x84,0x28,
+ 0x25,0x89,0xFA,0x56,0x1C,0xB0,0xC3,0x6F,0x57,0xFB,0x88,0x24,0x6E,0xC2,0xB1,0x1D,
+ 0xC1,0x6D,0x1E,0xB2,0xF8,0x54,0x27,0x8B,0xB3,0x1F,0x6C,0xC0,0x8A,0x26,0x55,0xF9,
+ 0x6A,0xC6,0xB5,0x19,0x53,0xFF,0x8C,0x20,0x18,0xB4,0xC7,0x6B,0x21,0x8D,0xFE,0x52,
+ 0x8E,0x22,0x51,0xFD,0xB7,0x1B,0x68,0xC4,0xFC,0x50,0x23,0x8F,0xC5,0x69,0x1A,0xB6},
+{0x00,0x13,0x26,0x35,0x4C,0x5F,0x6A,0x79,0x98,0x8B,0xBE,0xAD,0xD4,0xC7,0xF2,0xE1,
+ 0xB7,0xA4,0x91,0x82,0xFB,0xE8,0xDD,0xCE,0x2F,0x3C,0x09,0x1A,0x63,0x70,0x45,0x56,
+ 0xE9,0xFA,0xCF,0xDC,0xA5,0xB6,0x83,0x90,0x71,0x62,0x57,0x44,0x3D,0x2E,0x1B,0x08,
+ 0x5E,0x4D,0x78,0x6B,0x12,0x01,0x34,0x27,0xC6,0xD5,0xE0,0xF3,0x8A,0x99,0xAC,0xBF,
+ 0x55,0x46,0x73,0x60,0x19,0x0A,0x3F,0x2C,0xCD,0xDE,0xEB,0xF8,0x81,0x92,0xA7,0xB4,
+ 0xE2,0xF1,0xC4,0xD7,0xAE,0xBD,0x88,0x9B,0x7A,0x69,0x5C,0x4F,0x36,0x25,0x10,0x03,
+ 0xBC,0xAF,0x9A,0x89,0xF0,0xE3,0xD6,0xC5,0x24,0x37,0x02,0x11,0x68,0x7B,0x4E,0x5D,
+ 0x0B,0x18,0x2D,0x3E,0x47,0x54,0x61,0x72,0x93,0x80,0xB5,0xA6,0xDF,0xCC,0xF9,0xEA,
+ 0xAA,0xB9,0x8C,0x9F,0xE6,0xF5,0xC0,0xD3,0x32,0x21,0x14,0x07,0x7E,0x6D,0x58,0x4B,
+ 0x1D,0x0E,0x3B,0x28,0x51,0x42,0x77,0x64,0x85,0x96,0xA3,0xB0,0xC9,0xDA,0xEF,0xFC,
+ 0x43,0x50,0x65,0x76,0x0F,0x1C,0x29,0x3A,0xDB,0xC8,0xFD,0xEE,0x97,0x84,0xB1,0xA2,
+ 0xF4,0xE7,0xD2,0xC1,0xB8,0xAB,0x9E,0x8D,0x6C,0x7F,0x4A,0x59,0x20,0x33,0x06,0x15,
+ 0xFF,0xEC,0xD9,0xCA,0xB3,0xA0,0x95,0x86,0x67,0x74,0x41,0x52,0x2B,0x38,0x0D,0x1E,
+ 0x48,0x5B,0x6E,0x7D,0x04,0x17,0x22,0x31,0xD0,0xC3,0xF6,0xE5,0x9C,0x8F,0xBA,0xA9,
+ 0x16,0x05,0x30,0x23,0x5A,0x49,0x7C,0x6F,0x8E,0x9D,0xA8,0xBB,0xC2,0xD1,0xE4,0xF7,
+ 0xA1,0xB2,0x87,0x94,0xED,0xFE,0xCB,0xD8,0x39,0x2A,0x1F,0x0C,0x75,0x66,0x53,0x40},
+{0x00,0x84,0x8F,0x0B,0x99,0x1D,0x16,0x92,0xB5,0x31,0x3A,0xBE,0x2C,0xA8,0xA3,0x27,
+ 0xED,0x69,0x62,0xE6,0x74,0xF0,0xFB,0x7F,0x58,0xDC,0xD7,0x53,0xC1,0x45,0x4E,0xCA,
+ 0x5D,0xD9,0xD2,0x56,0xC4,0x40,0x4B,0xCF,0xE8,0x6C,0x67,0xE3,0x71,0xF5,0xFE,0x7A,
+ 0xB0,0x34,0x3F,0xBB,0x29,0xAD,0xA6,0x22,0x05,0x81,0x8A,0x0E,0x9C,0x18,0x13,0x97,
+ 0xBA,0x3E,0x35,0xB1,0x23,0xA7,0xAC,0x28,0x0F,0x8B,0x80,0x04,0x96,0x12,0x19,0x9D,
+ 0x57,0xD3,0xD8,0x5C,0xCE,0x4A,0x41,0xC5,0xE2,0x66,0x6D,0xE9,0x7B,0xFF,0xF4,0x70,
+ 0xE7,0x63,0x68,0xEC,0x7E,0xFA,0xF1,0x75,0x52,0xD6,0xDD,0x59,0xCB,0x4F,0x44,0xC0,
+ 0x0A,0x8E,0x85,0x01,0x93,0x17,0x1C,0x98,0xBF,0x3B,0x30,0xB4,0x26,0xA2,0xA9,0x2D,
+ 0xF3,0x77,0x7C,0xF8,0x6A,0xEE,0xE5,0x61,0x46,0xC2,0xC9,0x4D,0xDF,0x5B,0x50,0xD4,
+ 0x1E,0x9A,0x91,0x15,0x87,0x03,0x08,0x8C,0xAB,0x2F,0x24,0xA0,0x32,0xB6,0xBD,0x39,
+ 0xAE,0x2A,0x21,0xA5,0x37,0xB3,0xB8,0x3C,0x1B,0x9F,0x94,0x10,0x82,0x06,0x0D,0x89,
+ 0x43,0xC7,0xCC,0x48,0xDA,0x5E,0x55,0xD1,0xF6,0x72,0x79,0xFD,0x6F,0xEB,0xE0,0x64,
+ 0x49,0xCD,0xC6,0x42,0xD0,0x54,0x5F,0xDB,0xFC,0x78,0x73,0xF7,0x65,0xE1,0xEA,0x6E,
+ 0xA4,0x20,0x2B,0xAF,0x3D,0xB9,0xB2,0x36,0x11,0x95,0x9E,0x1A,0x88,0x0C,0x07,0x83,
+ 0x14,0x90,0x9B,0x1F,0x8D,0x09,0x02,0x86,0xA1,0x25,0x2E,0xAA,0x38,0xBC,0xB7,0x33,
+ 0xF9,0x7D,0x76,0xF2,0x60,0xE4,0xEF,0x6B,0x4C,0xC8,0xC3,0x47,0xD5,0x51,0x5A,0xDE},
+{0x00,0x06,0x0C,0x0A,0x18,0x1E,0x14,0x12,0x30,0x36,0x3C,0x3A,0x28,0x2E,0x24,0x22,
+ 0x60,0x66,0x6C,0x6A,0x78,0x7E,0x74,0x72,0x50,0x56,0x5C,0x5A,0x48,0x4E,0x44,0x42,
+ 0xC0,0xC6,0xCC,0xCA,0xD8,0xDE,0xD4,0xD2,0xF0,0xF6,0xFC,0xFA,0xE8,0xEE,0xE4,0xE2,
+ 0xA0,0xA6,0xAC,0xAA,0xB8,0xBE,0xB4,0xB2,0x90,0x96,0x9C,0x9A,0x88,0x8E,0x84,0x82,
+ 0x07,0x01,0x0B,0x0D,0x1F,0x19,0x13,0x15,0x37,0x31,0x3B,0x3D,0x2F,0x29,0x23,0x25,
+ 0x67,0x61,0x6B,0x6D,0x7F,0x79,0x73,0x75,0x57,0x51,0x5B,0x5D,0x4F,0x49,0x43,0x45,
+ 0xC7,0xC1,0xCB,0xCD,0xDF,0xD9,0xD3,0xD5,0xF7,0xF1,0xFB,0xFD,0xEF,0xE9,0xE3,0xE5,
+ 0xA7,0xA1,0xAB,0xAD,0xBF,0xB9,0xB3,0xB5,0x97,0x91,0x9B,0x9D,0x8F,0x89,0x83,0x85,
+ 0x0E,0x08,0x02,0x04,0x16,0x10,0x1A,0x1C,0x3E,0x38,0x32,0x34,0x26,0x20,0x2A,0x2C,
+ 0x6E,0x68,0x62,0x64,0x76,0x70,0x7A,0x7C,0x5E,0x58,0x52,0x54,0x46,0x40,0x4A,0x4C,
+ 0xCE,0xC8,0xC2,0xC4,0xD6,0xD0,0xDA,0xDC,0xFE,0xF8,0xF2,0xF4,0xE6,0xE0,0xEA,0xEC,
+ 0xAE,0xA8,0xA2,0xA4,0xB6,0xB0,0xBA,0xBC,0x9E,0x98,0x92,0x94,0x86,0x80,0x8A,0x8C,
+ 0x09,0x0F,0x05,0x03,0x11,0x17,0x1D,0x1B,0x39,0x3F,0x35,0x33,0x21,0x27,0x2D,0x2B,
+ 0x69,0x6F,0x65,0x63,0x71,0x77,0x7D,0x7B,0x59,0x5F,0x55,0x53,0x41,0x47,0x4D,0x4B,
+ 0xC9,0xCF,0xC5,0xC3,0xD1,0xD7,0xDD,0xDB,0xF9,0xFF,0xF5,0xF3,0xE1,0xE7,0xED,0xEB,
+ 0xA9,0xAF,0xA5,0xA3,0xB1,0xB7,0xBD,0xBB,0x99,0x9F,0x95,0x93,0x81,0x87,0x8D,0x8B},
+{0x00,0xE0,0x47,0xA7,0x8E,0x6E,0xC9,0x29,0x9B,0x7B,0xDC,0x3C,0x15,0xF5,0x52,0xB2,
+ 0xB1,0x51,0xF6,0x16,0x3F,0xDF,0x78,0x98,0x2A,0xCA,0x6D,0x8D,0xA4,0x44,0xE3,0x03,
+ 0xE5,0x05,0xA2,0x42,0x6B,0x8B,0x2C,0xCC,0x7E,0x9E,0x39,0xD9,0xF0,0x10,0xB7,0x57,
+ 0x54,0xB4,0x13,0xF3,0xDA,0x3A,0x9D,0x7D,0xCF,0x2F,0x88,0x68,0x41,0xA1,0x06,0xE6,
+ 0x4D,0xAD,0x0A,0xEA,0xC3,0x23,0x84,0x64,0xD6,0x36,0x91,0x71,0x58,0xB8,0x1F,0xFF,
+ 0xFC,0x1C,0xBB,0x5B,0x72,0x92,0x35,0xD5,0x67,0x87,0x20,0xC0,0xE9,0x09,0xAE,0x4E,
+ 0xA8,0x48,0xEF,0x0F,0x26,0xC6,0x61,0x81,0x33,0xD3,0x74,0x94,0xBD,0x5D,0xFA,0x1A,
+ 0x19,0xF9,0x5E,0xBE,0x97,0x77,0xD0,0x30,0x82,0x62,0xC5,0x25,0x0C,0xEC,0x4B,0xAB,
+ 0x9A,0x7A,0xDD,0x3D,0x14,0xF4,0x53,0xB3,0x01,0xE1,0x46,0xA6,0x8F,0x6F,0xC8,0x28,
+ 0x2B,0xCB,0x6C,0x8C,0xA5,0x45,0xE2,0x02,0xB0,0x50,0xF7,0x17,0x3E,0xDE,0x79,0x99,
+ 0x7F,0x9F,0x38,0xD8,0xF1,0x11,0xB6,0x56,0xE4,0x04,0xA3,0x43,0x6A,0x8A,0x2D,0xCD,
+ 0xCE,0x2E,0x89,0x69,0x40,0xA0,0x07,0xE7,0x55,0xB5,0x12,0xF2,0xDB,0x3B,0x9C,0x7C,
+ 0xD7,0x37,0x90,0x70,0x59,0xB9,0x1E,0xFE,0x4C,0xAC,0x0B,0xEB,0xC2,0x22,0x85,0x65,
+ 0x66,0x86,0x21,0xC1,0xE8,0x08,0xAF,0x4F,0xFD,0x1D,0xBA,0x5A,0x73,0x93,0x34,0xD4,
+ 0x32,0xD2,0x75,0x95,0xBC,0x5C,0xFB,0x1B,0xA9,0x49,0xEE,0x0E,0x27,0xC7,0x60,0x80,
+ 0x83,0x63,0xC4,0x24,0x0D,0xED,0x4A,0xAA,0x18,0xF8,0x5F,0xBF,0x96,0x76,0xD1,0x31},
+{0x00,0x8A,0x93,0x19,0xA1,0x2B,0x32,0xB8,0xC5,0x4F,0x56,0xDC,0x64,0xEE,0xF7,0x7D,
+ 0x0D,0x87,0x9E,0x14,0xAC,0x26,0x3F,0xB5,0xC8,0x42,0x5B,0xD1,0x69,0xE3,0xFA,0x70,
+ 0x1A,0x90,0x89,0x03,0xBB,0x31,0x28,0xA2,0xDF,0x55,0x4C,0xC6,0x7E,0xF4,0xED,0x67,
+ 0x17,0x9D,0x84,0x0E,0xB6,0x3C,0x25,0xAF,0xD2,0x58,0x41,0xCB,0x73,0xF9,0xE0,0x6A,
+ 0x34,0xBE,0xA7,0x2D,0x95,0x1F,0x06,0x8C,0xF1,0x7B,0x62,0xE8,0x50,0xDA,0xC3,0x49,
+ 0x39,0xB3,0xAA,0x20,0x98,0x12,0x0B,0x81,0xFC,0x76,0x6F,0xE5,0x5D,0xD7,0xCE,0x44,
+ 0x2E,0xA4,0xBD,0x37,0x8F,0x05,0x1C,0x96,0xEB,0x61,0x78,0xF2,0x4A,0xC0,0xD9,0x53,
+ 0x23,0xA9,0xB0,0x3A,0x82,0x08,0x11,0x9B,0xE6,0x6C,0x75,0xFF,0x47,0xCD,0xD4,0x5E,
+ 0x68,0xE2,0xFB,0x71,0xC9,0x43,0x5A,0xD0,0xAD,0x27,0x3E,0xB4,0x0C,0x86,0x9F,0x15,
+ 0x65,0xEF,0xF6,0x7C,0xC4,0x4E,0x57,0xDD,0xA0,0x2A,0x33,0xB9,0x01,0x8B,0x92,0x18,
+ 0x72,0xF8,0xE1,0x6B,0xD3,0x59,0x40,0xCA,0xB7,0x3D,0x24,0xAE,0x16,0x9C,0x85,0x0F,
+ 0x7F,0xF5,0xEC,0x66,0xDE,0x54,0x4D,0xC7,0xBA,0x30,0x29,0xA3,0x1B,0x91,0x88,0x02,
+ 0x5C,0xD6,0xCF,0x45,0xFD,0x77,0x6E,0xE4,0x99,0x13,0x0A,0x80,0x38,0xB2,0xAB,0x21,
+ 0x51,0xDB,0xC2,0x48,0xF0,0x7A,0x63,0xE9,0x94,0x1E,0x07,0x8D,0x35,0xBF,0xA6,0x2C,
+ 0x46,0xCC,0xD5,0x5F,0xE7,0x6D,0x74,0xFE,0x83,0x09,0x10,0x9A,0x22,0xA8,0xB1,0x3B,
+ 0x4B,0xC1,0xD8,0x52,0xEA,0x60,0x79,0xF3,0x8E,0x04,0x1D,0x97,0x2F,0xA5,0xBC,0x36},
+{0x00,0x9C,0xBF,0x23,0xF9,0x65,0x46,0xDA,0x75,0xE9,0xCA,0x56,0x8C,0x10,0x33,0xAF,
+ 0xEA,0x76,0x55,0xC9,0x13,0x8F,0xAC,0x30,0x9F,0x03,0x20,0xBC,0x66,0xFA,0xD9,0x45,
+ 0x53,0xCF,0xEC,0x70,0xAA,0x36,0x15,0x89,0x26,0xBA,0x99,0x05,0xDF,0x43,0x60,0xFC,
+ 0xB9,0x25,0x06,0x9A,0x40,0xDC,0xFF,0x63,0xCC,0x50,0x73,0xEF,0x35,0xA9,0x8A,0x16,
+ 0xA6,0x3A,0x19,0x85,0x5F,0xC3,0xE0,0x7C,0xD3,0x4F,0x6C,0xF0,0x2A,0xB6,0x95,0x09,
+ 0x4C,0xD0,0xF3,0x6F,0xB5,0x29,0x0A,0x96,0x39,0xA5,0x86,0x1A,0xC0,0x5C,0x7F,0xE3,
+ 0xF5,0x69,0x4A,0xD6,0x0C,0x90,0xB3,0x2F,0x80,0x1C,0x3F,0xA3,0x79,0xE5,0xC6,0x5A,
+ 0x1F,0x83,0xA0,0x3C,0xE6,0x7A,0x59,0xC5,0x6A,0xF6,0xD5,0x49,0x93,0x0F,0x2C,0xB0,
+ 0xCB,0x57,0x74,0xE8,0x32,0xAE,0x8D,0x11,0xBE,0x22,0x01,0x9D,0x47,0xDB,0xF8,0x64,
+ 0x21,0xBD,0x9E,0x02,0xD8,0x44,0x67,0xFB,0x54,0xC8,0xEB,0x77,0xAD,0x31,0x12,0x8E,
+ 0x98,0x04,0x27,0xBB,0x61,0xFD,0xDE,0x42,0xED,0x71,0x52,0xCE,0x14,0x88,0xAB,0x37,
+ 0x72,0xEE,0xCD,0x51,0x8B,0x17,0x34,0xA8,0x07,0x9B,0xB8,0x24,0xFE,0x62,0x41,0xDD,
+ 0x6D,0xF1,0xD2,0x4E,0x94,0x08,0x2B,0xB7,0x18,0x84,0xA7,0x3B,0xE1,0x7D,0x5E,0xC2,
+ 0x87,0x1B,0x38,0xA4,0x7E,0xE2,0xC1,0x5D,0xF2,0x6E,0x4D,0xD1,0x0B,0x97,0xB4,0x28,
+ 0x3E,0xA2,0x81,0x1D,0xC7,0x5B,0x78,0xE4,0x4B,0xD7,0xF4,0x68,0xB2,0x2E,0x0D,0x91,
+ 0xD4,0x48,0x6B,0xF7,0x2D,0xB1,0x92,0x0E,0xA1,0x3D,0x1E,0x82,0x58,0xC4,0xE7,0x7B},
+{0x00,0x88,0x97,0x1F,0xA9,0x21,0x3E,0xB6,0xD5,0x5D,0x42,0xCA,0x7C,0xF4,0xEB,0x63,
+ 0x2D,0xA5,0xBA,0x32,0x84,0x0C,0x13,0x9B,0xF8,0x70,0x6F,0xE7,0x51,0xD9,0xC6,0x4E,
+ 0x5A,0xD2,0xCD,0x45,0xF3,0x7B,0x64,0xEC,0x8F,0x07,0x18,0x90,0x26,0xAE,0xB1,0x39,
+ 0x77,0xFF,0xE0,0x68,0xDE,0x56,0x49,0xC1,0xA2,0x2A,0x35,0xBD,0x0B,0x83,0x9C,0x14,
+ 0xB4,0x3C,0x23,0xAB,0x1D,0x95,0x8A,0x02,0x61,0xE9,0xF6,0x7E,0xC8,0x40,0x5F,0xD7,
+ 0x99,0x11,0x0E,0x86,0x30,0xB8,0xA7,0x2F,0x4C,0xC4,0xDB,0x53,0xE5,0x6D,0x72,0xFA,
+ 0xEE,0x66,0x79,0xF1,0x47,0xCF,0xD0,0x58,0x3B,0xB3,0xAC,0x24,0x92,0x1A,0x05,0x8D,
+ 0xC3,0x4B,0x54,0xDC,0x6A,0xE2,0xFD,0x75,0x16,0x9E,0x81,0x09,0xBF,0x37,0x28,0xA0,
+ 0xEF,0x67,0x78,0xF0,0x46,0xCE,0xD1,0x59,0x3A,0xB2,0xAD,0x25,0x93,0x1B,0x04,0x8C,
+ 0xC2,0x4A,0x55,0xDD,0x6B,0xE3,0xFC,0x74,0x17,0x9F,0x80,0x08,0xBE,0x36,0x29,0xA1,
+ 0xB5,0x3D,0x22,0xAA,0x1C,0x94,0x8B,0x03,0x60,0xE8,0xF7,0x7F,0xC9,0x41,0x5E,0xD6,
+ 0x98,0x10,0x0F,0x87,0x31,0xB9,0xA6,0x2E,0x4D,0xC5,0xDA,0x52,0xE4,0x6C,0x73,0xFB,
+ 0x5B,0xD3,0xCC,0x44,0xF2,0x7A,0x65,0xED,0x8E,0x06,0x19,0x91,0x27,0xAF,0xB0,0x38,
+ 0x76,0xFE,0xE1,0x69,0xDF,0x57,0x48,0xC0,0xA3,0x2B,0x34,0xBC,0x0A,0x82,0x9D,0x15,
+ 0x01,0x89,0x96,0x1E,0xA8,0x20,0x3F,0xB7,0xD4,0x5C,0x43,0xCB,0x7D,0xF5,0xEA,0x62,
+ 0x2C,0xA4,0xBB,0x33,0x85,0x0D,0x12,0x9A,0xF9,0x71,0x6E,0xE6,0x50,0xD8,0xC7,0x4F},
+{0x00,0x41,0x82,0xC3,0x83,0xC2,0x01,0x40,0x81,0xC0,0x03,0x42,0x02,0x43,0x80,0xC1,
+ 0x85,0xC4,0x07,0x46,0x06,0x47,0x84,0xC5,0x04,0x45,0x86,0xC7,0x87,0xC6,0x05,0x44,
+ 0x8D,0xCC,0x0F,0x4E,0x0E,0x4F,0x8C,0xCD,0x0C,0x4D,0x8E,0xCF,0x8F,0xCE,0x0D,0x4C,
+ 0x08,0x49,0x8A,0xCB,0x8B,0xCA,0x09,0x48,0x89,0xC8,0x0B,0x4A,0x0A,0x4B,0x88,0xC9,
+ 0x9D,0xDC,0x1F,0x5E,0x1E,0x5F,0x9C,0xDD,0x1C,0x5D,0x9E,0xDF,0x9F,0xDE,0x1D,0x5C,
+ 0x18,0x59,0x9A,0xDB,0x9B,0xDA,0x19,0x58,0x99,0xD8,0x1B,0x5A,0x1A,0x5B,0x98,0xD9,
+ 0x10,0x51,0x92,0xD3,0x93,0xD2,0x11,0x50,0x91,0xD0,0x13,0x52,0x12,0x53,0x90,0xD1,
+ 0x95,0xD4,0x17,0x56,0x16,0x57,0x94,0xD5,0x14,0x55,0x96,0xD7,0x97,0xD6,0x15,0x54,
+ 0xBD,0xFC,0x3F,0x7E,0x3E,0x7F,0xBC,0xFD,0x3C,0x7D,0xBE,0xFF,0xBF,0xFE,0x3D,0x7C,
+ 0x38,0x79,0xBA,0xFB,0xBB,0xFA,0x39,0x78,0xB9,0xF8,0x3B,0x7A,0x3A,0x7B,0xB8,0xF9,
+ 0x30,0x71,0xB2,0xF3,0xB3,0xF2,0x31,0x70,0xB1,0xF0,0x33,0x72,0x32,0x73,0xB0,0xF1,
+ 0xB5,0xF4,0x37,0x76,0x36,0x77,0xB4,0xF5,0x34,0x75,0xB6,0xF7,0xB7,0xF6,0x35,0x74,
+ 0x20,0x61,0xA2,0xE3,0xA3,0xE2,0x21,0x60,0xA1,0xE0,0x23,0x62,0x22,0x63,0xA0,0xE1,
+ 0xA5,0xE4,0x27,0x66,0x26,0x67,0xA4,0xE5,0x24,0x65,0xA6,0xE7,0xA7,0xE6,0x25,0x64,
+ 0xAD,0xEC,0x2F,0x6E,0x2E,0x6F,0xAC,0xED,0x2C,0x6D,0xAE,0xEF,0xAF,0xEE,0x2D,0x6C,
+ 0x28,0x69,0xAA,0xEB,0xAB,0xEA,0x29,0x68,0xA9,0xE8,0x2B,0x6A,0x2A,0x6B,0xA8,0xE9},
+{0x00,0x73,0xE6,0x95,0x4B,0x38,0xAD,0xDE,0x96,0xE5,0x70,0x03,0xDD,0xAE,0x3B,0x48,
+ 0xAB,0xD8,0x4D,0x3E,0xE0,0x93,0x06,0x75,0x3D,0x4E,0xDB,0xA8,0x76,0x05,0x90,0xE3,
+ 0xD1,0xA2,0x37,0x44,0x9A,0xE9,0x7C,0x0F,0x47,0x34,0xA1,0xD2,0x0C,0x7F,0xEA,0x99,
+ 0x7A,0x09,0x9C,0xEF,0x31,0x42,0xD7,0xA4,0xEC,0x9F,0x0A,0x79,0xA7,0xD4,0x41,0x32,
+ 0x25,0x56,0xC3,0xB0,0x6E,0x1D,0x88,0xFB,0xB3,0xC0,0x55,0x26,0xF8,0x8B,0x1E,0x6D,
+ 0x8E,0xFD,0x68,0x1B,0xC5,0xB6,0x23,0x50,0x18,0x6B,0xFE,0x8D,0x53,0x20,0xB5,0xC6,
+ 0xF4,0x87,0x12,0x61,0xBF,0xCC,0x59,0x2A,0x62,0x11,0x84,0xF7,0x29,0x5A,0xCF,0xBC,
+ 0x5F,0x2C,0xB9,0xCA,0x14,0x67,0xF2,0x81,0xC9,0xBA,0x2F,0x5C,0x82,0xF1,0x64,0x17,
+ 0x4A,0x39,0xAC,0xDF,0x01,0x72,0xE7,0x94,0xDC,0xAF,0x3A,0x49,0x97,0xE4,0x71,0x02,
+ 0xE1,0x92,0x07,0x74,0xAA,0xD9,0x4C,0x3F,0x77,0x04,0x91,0xE2,0x3C,0x4F,0xDA,0xA9,
+ 0x9B,0xE8,0x7D,0x0E,0xD0,0xA3,0x36,0x45,0x0D,0x7E,0xEB,0x98,0x46,0x35,0xA0,0xD3,
+ 0x30,0x43,0xD6,0xA5,0x7B,0x08,0x9D,0xEE,0xA6,0xD5,0x40,0x33,0xED,0x9E,0x0B,0x78,
+ 0x6F,0x1C,0x89,0xFA,0x24,0x57,0xC2,0xB1,0xF9,0x8A,0x1F,0x6C,0xB2,0xC1,0x54,0x27,
+ 0xC4,0xB7,0x22,0x51,0x8F,0xFC,0x69,0x1A,0x52,0x21,0xB4,0xC7,0x19,0x6A,0xFF,0x8C,
+ 0xBE,0xCD,0x58,0x2B,0xF5,0x86,0x13,0x60,0x28,0x5B,0xCE,0xBD,0x63,0x10,0x85,0xF6,
+ 0x15,0x66,0xF3,0x80,0x5E,0x2D,0xB8,0xCB,0x83,0xF0,0x65,0x16,0xC8,0xBB,0x2E,0x5D},
+{0x00,0x35,0x6A,0x5F,0xD4,0xE1,0xBE,0x8B,0x2F,0x1A,0x45,0x70,0xFB,0xCE,0x91,0xA4,
+ 0x5E,0x6B,0x34,0x01,0x8A,0xBF,0xE0,0xD5,0x71,0x44,0x1B,0x2E,0xA5,0x90,0xCF,0xFA,
+ 0xBC,0x89,0xD6,0xE3,0x68,0x5D,0x02,0x37,0x93,0xA6,0xF9,0xCC,0x47,0x72,0x2D,0x18,
+ 0xE2,0xD7,0x88,0xBD,0x36,0x03,0x5C,0x69,0xCD,0xF8,0xA7,0x92,0x19,0x2C,0x73,0x46,
+ 0xFF,0xCA,0x95,0xA0,0x2B,0x1E,0x41,0x74,0xD0,0xE5,0xBA,0x8F,0x04,0x31,0x6E,0x5B,
+ 0xA1,0x94,0xCB,0xFE,0x75,0x40,0x1F,0x2A,0x8E,0xBB,0xE4,0xD1,0x5A,0x6F,0x30,0x05,
+ 0x43,0x76,0x29,0x1C,0x97,0xA2,0xFD,0xC8,0x6C,0x59,0x06,0x33,0xB8,0x8D,0xD2,0xE7,
+ 0x1D,0x28,0x77,0x42,0xC9,0xFC,0xA3,0x96,0x32,0x07,0x58,0x6D,0xE6,0xD3,0x8C,0xB9,
+ 0x79,0x4C,0x13,0x26,0xAD,0x98,0xC7,0xF2,0x56,0x63,0x3C,0x09,0x82,0xB7,0xE8,0xDD,
+ 0x27,0x12,0x4D,0x78,0xF3,0xC6,0x99,0xAC,0x08,0x3D,0x62,0x57,0xDC,0xE9,0xB6,0x83,
+ 0xC5,0xF0,0xAF,0x9A,0x11,0x24,0x7B,0x4E,0xEA,0xDF,0x80,0xB5,0x3E,0x0B,0x54,0x61,
+ 0x9B,0xAE,0xF1,0xC4,0x4F,0x7A,0x25,0x10,0xB4,0x81,0xDE,0xEB,0x60,0x55,0x0A,0x3F,
+ 0x86,0xB3,0xEC,0xD9,0x52,0x67,0x38,0x0D,0xA9,0x9C,0xC3,0xF6,0x7D,0x48,0x17,0x22,
+ 0xD8,0xED,0xB2,0x87,0x0C,0x39,0x66,0x53,0xF7,0xC2,0x9D,0xA8,0x23,0x16,0x49,0x7C,
+ 0x3A,0x0F,0x50,0x65,0xEE,0xDB,0x84,0xB1,0x15,0x20,0x7F,0x4A,0xC1,0xF4,0xAB,0x9E,
+ 0x64,0x51,0x0E,0x3B,0xB0,0x85,0xDA,0xEF,0x4B,0x7E,0x21,0x14,0x9F,0xAA,0xF5,0xC0},
+{0x00,0x0B,0x16,0x1D,0x2C,0x27,0x3A,0x31,0x58,0x53,0x4E,0x45,0x74,0x7F,0x62,0x69,
+ 0xB0,0xBB,0xA6,0xAD,0x9C,0x97,0x8A,0x81,0xE8,0xE3,0xFE,0xF5,0xC4,0xCF,0xD2,0xD9,
+ 0xE7,0xEC,0xF1,0xFA,0xCB,0xC0,0xDD,0xD6,0xBF,0xB4,0xA9,0xA2,0x93,0x98,0x85,0x8E,
+ 0x57,0x5C,0x41,0x4A,0x7B,0x70,0x6D,0x66,0x0F,0x04,0x19,0x12,0x23,0x28,0x35,0x3E,
+ 0x49,0x42,0x5F,0x54,0x65,0x6E,0x73,0x78,0x11,0x1A,0x07,0x0C,0x3D,0x36,0x2B,0x20,
+ 0xF9,0xF2,0xEF,0xE4,0xD5,0xDE,0xC3,0xC8,0xA1,0xAA,0xB7,0xBC,0x8D,0x86,0x9B,0x90,
+ 0xAE,0xA5,0xB8,0xB3,0x82,0x89,0x94,0x9F,0xF6,0xFD,0xE0,0xEB,0xDA,0xD1,0xCC,0xC7,
+ 0x1E,0x15,0x08,0x03,0x32,0x39,0x24,0x2F,0x46,0x4D,0x50,0x5B,0x6A,0x61,0x7C,0x77,
+ 0x92,0x99,0x84,0x8F,0xBE,0xB5,0xA8,0xA3,0xCA,0xC1,0xDC,0xD7,0xE6,0xED,0xF0,0xFB,
+ 0x22,0x29,0x34,0x3F,0x0E,0x05,0x18,0x13,0x7A,0x71,0x6C,0x67,0x56,0x5D,0x40,0x4B,
+ 0x75,0x7E,0x63,0x68,0x59,0x52,0x4F,0x44,0x2D,0x26,0x3B,0x30,0x01,0x0A,0x17,0x1C,
+ 0xC5,0xCE,0xD3,0xD8,0xE9,0xE2,0xFF,0xF4,0x9D,0x96,0x8B,0x80,0xB1,0xBA,0xA7,0xAC,
+ 0xDB,0xD0,0xCD,0xC6,0xF7,0xFC,0xE1,0xEA,0x83,0x88,0x95,0x9E,0xAF,0xA4,0xB9,0xB2,
+ 0x6B,0x60,0x7D,0x76,0x47,0x4C,0x51,0x5A,0x33,0x38,0x25,0x2E,0x1F,0x14,0x09,0x02,
+ 0x3C,0x37,0x2A,0x21,0x10,0x1B,0x06,0x0D,0x64,0x6F,0x72,0x79,0x48,0x43,0x5E,0x55,
+ 0x8C,0x87,0x9A,0x91,0xA0,0xAB,0xB6,0xBD,0xD4,0xDF,0xC2,0xC9,0xF8,0xF3,0xEE,0xE5},
+{0x00,0x0A,0x14,0x1E,0x28,0x22,0x3C,0x36,0x50,0x5A,0x44,0x4E,0x78,0x72,0x6C,0x66,
+ 0xA0,0xAA,0xB4,0xBE,0x88,0x82,0x9C,0x96,0xF0,0xFA,0xE4,0xEE,0xD8,0xD2,0xCC,0xC6,
+ 0xC7,0xCD,0xD3,0xD9,0xEF,0xE5,0xFB,0xF1,0x97,0x9D,0x83,0x89,0xBF,0xB5,0xAB,0xA1,
+ 0x67,0x6D,0x73,0x79,0x4F,0x45,0x5B,0x51,0x37,0x3D,0x23,0x29,0x1F,0x15,0x0B,0x01,
+ 0x09,0x03,0x1D,0x17,0x21,0x2B,0x35,0x3F,0x59,0x53,0x4D,0x47,0x71,0x7B,0x65,0x6F,
+ 0xA9,0xA3,0xBD,0xB7,0x81,0x8B,0x95,0x9F,0xF9,0xF3,0xED,0xE7,0xD1,0xDB,0xC5,0xCF,
+ 0xCE,0xC4,0xDA,0xD0,0xE6,0xEC,0xF2,0xF8,0x9E,0x94,0x8A,0x80,0xB6,0xBC,0xA2,0xA8,
+ 0x6E,0x64,0x7A,0x70,0x46,0x4C,0x52,0x58,0x3E,0x34,0x2A,0x20,0x16,0x1C,0x02,0x08,
+ 0x12,0x18,0x06,0x0C,0x3A,0x30,0x2E,0x24,0x42,0x48,0x56,0x5C,0x6A,0x60,0x7E,0x74,
+ 0xB2,0xB8,0xA6,0xAC,0x9A,0x90,0x8E,0x84,0xE2,0xE8,0xF6,0xFC,0xCA,0xC0,0xDE,0xD4,
+ 0xD5,0xDF,0xC1,0xCB,0xFD,0xF7,0xE9,0xE3,0x85,0x8F,0x91,0x9B,0xAD,0xA7,0xB9,0xB3,
+ 0x75,0x7F,0x61,0x6B,0x5D,0x57,0x49,0x43,0x25,0x2F,0x31,0x3B,0x0D,0x07,0x19,0x13,
+ 0x1B,0x11,0x0F,0x05,0x33,0x39,0x27,0x2D,0x4B,0x41,0x5F,0x55,0x63,0x69,0x77,0x7D,
+ 0xBB,0xB1,0xAF,0xA5,0x93,0x99,0x87,0x8D,0xEB,0xE1,0xFF,0xF5,0xC3,0xC9,0xD7,0xDD,
+ 0xDC,0xD6,0xC8,0xC2,0xF4,0xFE,0xE0,0xEA,0x8C,0x86,0x98,0x92,0xA4,0xAE,0xB0,0xBA,
+ 0x7C,0x76,0x68,0x62,0x54,0x5E,0x40,0x4A,0x2C,0x26,0x38,0x32,0x04,0x0E,0x10,0x1A},
+{0x00,0xA7,0xC9,0x6E,0x15,0xB2,0xDC,0x7B,0x2A,0x8D,0xE3,0x44,0x3F,0x98,0xF6,0x51,
+ 0x54,0xF3,0x9D,0x3A,0x41,0xE6,0x88,0x2F,0x7E,0xD9,0xB7,0x10,0x6B,0xCC,0xA2,0x05,
+ 0xA8,0x0F,0x61,0xC6,0xBD,0x1A,0x74,0xD3,0x82,0x25,0x4B,0xEC,0x97,0x30,0x5E,0xF9,
+ 0xFC,0x5B,0x35,0x92,0xE9,0x4E,0x20,0x87,0xD6,0x71,0x1F,0xB8,0xC3,0x64,0x0A,0xAD,
+ 0xD7,0x70,0x1E,0xB9,0xC2,0x65,0x0B,0xAC,0xFD,0x5A,0x34,0x93,0xE8,0x4F,0x21,0x86,
+ 0x83,0x24,0x4A,0xED,0x96,0x31,0x5F,0xF8,0xA9,0x0E,0x60,0xC7,0xBC,0x1B,0x75,0xD2,
+ 0x7F,0xD8,0xB6,0x11,0x6A,0xCD,0xA3,0x04,0x55,0xF2,0x9C,0x3B,0x40,0xE7,0x89,0x2E,
+ 0x2B,0x8C,0xE2,0x45,0x3E,0x99,0xF7,0x50,0x01,0xA6,0xC8,0x6F,0x14,0xB3,0xDD,0x7A,
+ 0x29,0x8E,0xE0,0x47,0x3C,0x9B,0xF5,0x52,0x03,0xA4,0xCA,0x6D,0x16,0xB1,0xDF,0x78,
+ 0x7D,0xDA,0xB4,0x13,0x68,0xCF,0xA1,0x06,0x57,0xF0,0x9E,0x39,0x42,0xE5,0x8B,0x2C,
+ 0x81,0x26,0x48,0xEF,0x94,0x33,0x5D,0xFA,0xAB,0x0C,0x62,0xC5,0xBE,0x19,0x77,0xD0,
+ 0xD5,0x72,0x1C,0xBB,0xC0,0x67,0x09,0xAE,0xFF,0x58,0x36,0x91,0xEA,0x4D,0x23,0x84,
+ 0xFE,0x59,0x37,0x90,0xEB,0x4C,0x22,0x85,0xD4,0x73,0x1D,0xBA,0xC1,0x66,0x08,0xAF,
+ 0xAA,0x0D,0x63,0xC4,0xBF,0x18,0x76,0xD1,0x80,0x27,0x49,0xEE,0x95,0x32,0x5C,0xFB,
+ 0x56,0xF1,0x9F,0x38,0x43,0xE4,0x8A,0x2D,0x7C,0xDB,0xB5,0x12,0x69,0xCE,0xA0,0x07,
+ 0x02,0xA5,0xCB,0x6C,0x17,0xB0,0xDE,0x79,0x28,0x8F,0xE1,0x46,0x3D,0x9A,0xF4,0x53},
+{0x00,0x19,0x32,0x2B,0x64,0x7D,0x56,0x4F,0xC8,0xD1,0xFA,0xE3,0xAC,0xB5,0x9E,0x87,
+ 0x17,0x0E,0x25,0x3C,0x73,0x6A,0x41,0x58,0xDF,0xC6,0xED,0xF4,0xBB,0xA2,0x89,0x90,
+ 0x2E,0x37,0x1C,0x05,0x4A,0x53,0x78,0x61,0xE6,0xFF,0xD4,0xCD,0x82,0x9B,0xB0,0xA9,
+ 0x39,0x20,0x0B,0x12,0x5D,0x44,0x6F,0x76,0xF1,0xE8,0xC3,0xDA,0x95,0x8C,0xA7,0xBE,
+ 0x5C,0x45,0x6E,0x77,0x38,0x21,0x0A,0x13,0x94,0x8D,0xA6,0xBF,0xF0,0xE9,0xC2,0xDB,
+ 0x4B,0x52,0x79,0x60,0x2F,0x36,0x1D,0x04,0x83,0x9A,0xB1,0xA8,0xE7,0xFE,0xD5,0xCC,
+ 0x72,0x6B,0x40,0x59,0x16,0x0F,0x24,0x3D,0xBA,0xA3,0x88,0x91,0xDE,0xC7,0xEC,0xF5,
+ 0x65,0x7C,0x57,0x4E,0x01,0x18,0x33,0x2A,0xAD,0xB4,0x9F,0x86,0xC9,0xD0,0xFB,0xE2,
+ 0xB8,0xA1,0x8A,0x93,0xDC,0xC5,0xEE,0xF7,0x70,0x69,0x42,0x5B,0x14,0x0D,0x26,0x3F,
+ 0xAF,0xB6,0x9D,0x84,0xCB,0xD2,0xF9,0xE0,0x67,0x7E,0x55,0x4C,0x03,0x1A,0x31,0x28,
+ 0x96,0x8F,0xA4,0xBD,0xF2,0xEB,0xC0,0xD9,0x5E,0x47,0x6C,0x75,0x3A,0x23,0x08,0x11,
+ 0x81,0x98,0xB3,0xAA,0xE5,0xFC,0xD7,0xCE,0x49,0x50,0x7B,0x62,0x2D,0x34,0x1F,0x06,
+ 0xE4,0xFD,0xD6,0xCF,0x80,0x99,0xB2,0xAB,0x2C,0x35,0x1E,0x07,0x48,0x51,0x7A,0x63,
+ 0xF3,0xEA,0xC1,0xD8,0x97,0x8E,0xA5,0xBC,0x3B,0x22,0x09,0x10,0x5F,0x46,0x6D,0x74,
+ 0xCA,0xD3,0xF8,0xE1,0xAE,0xB7,0x9C,0x85,0x02,0x1B,0x30,0x29,0x66,0x7F,0x54,0x4D,
+ 0xDD,0xC4,0xEF,0xF6,0xB9,0xA0,0x8B,0x92,0x15,0x0C,0x27,0x3E,0x71,0x68,0x43,0x5A},
+{0x00,0x23,0x46,0x65,0x8C,0xAF,0xCA,0xE9,0x9F,0xBC,0xD9,0xFA,0x13,0x30,0x55,0x76,
+ 0xB9,0x9A,0xFF,0xDC,0x35,0x16,0x73,0x50,0x26,0x05,0x60,0x43,0xAA,0x89,0xEC,0xCF,
+ 0xF5,0xD6,0xB3,0x90,0x79,0x5A,0x3F,0x1C,0x6A,0x49,0x2C,0x0F,0xE6,0xC5,0xA0,0x83,
+ 0x4C,0x6F,0x0A,0x29,0xC0,0xE3,0x86,0xA5,0xD3,0xF0,0x95,0xB6,0x5F,0x7C,0x19,0x3A,
+ 0x6D,0x4E,0x2B,0x08,0xE1,0xC2,0xA7,0x84,0xF2,0xD1,0xB4,0x97,0x7E,0x5D,0x38,0x1B,
+ 0xD4,0xF7,0x92,0xB1,0x58,0x7B,0x1E,0x3D,0x4B,0x68,0x0D,0x2E,0xC7,0xE4,0x81,0xA2,
+ 0x98,0xBB,0xDE,0xFD,0x14,0x37,0x52,0x71,0x07,0x24,0x41,0x62,0x8B,0xA8,0xCD,0xEE,
+ 0x21,0x02,0x67,0x44,0xAD,0x8E,0xEB,0xC8,0xBE,0x9D,0xF8,0xDB,0x32,0x11,0x74,0x57,
+ 0xDA,0xF9,0x9C,0xBF,0x56,0x75,0x10,0x33,0x45,0x66,0x03,0x20,0xC9,0xEA,0x8F,0xAC,
+ 0x63,0x40,0x25,0x06,0xEF,0xCC,0xA9,0x8A,0xFC,0xDF,0xBA,0x99,0x70,0x53,0x36,0x15,
+ 0x2F,0x0C,0x69,0x4A,0xA3,0x80,0xE5,0xC6,0xB0,0x93,0xF6,0xD5,0x3C,0x1F,0x7A,0x59,
+ 0x96,0xB5,0xD0,0xF3,0x1A,0x39,0x5C,0x7F,0x09,0x2A,0x4F,0x6C,0x85,0xA6,0xC3,0xE0,
+ 0xB7,0x94,0xF1,0xD2,0x3B,0x18,0x7D,0x5E,0x28,0x0B,0x6E,0x4D,0xA4,0x87,0xE2,0xC1,
+ 0x0E,0x2D,0x48,0x6B,0x82,0xA1,0xC4,0xE7,0x91,0xB2,0xD7,0xF4,0x1D,0x3E,0x5B,0x78,
+ 0x42,0x61,0x04,0x27,0xCE,0xED,0x88,0xAB,0xDD,0xFE,0x9B,0xB8,0x51,0x72,0x17,0x34,
+ 0xFB,0xD8,0xBD,0x9E,0x77,0x54,0x31,0x12,0x64,0x47,0x22,0x01,0xE8,0xCB,0xAE,0x8D},
+{0x00,0x1F,0x3E,0x21,0x7C,0x63,0x42,0x5D,0xF8,0xE7,0xC6,0xD9,0x84,0x9B,0xBA,0xA5,
+ 0x77,0x68,0x49,0x56,0x0B,0x14,0x35,0x2A,0x8F,0x90,0xB1,0xAE,0xF3,0xEC,0xCD,0xD2,
+ 0xEE,0xF1,0xD0,0xCF,0x92,0x8D,0xAC,0xB3,0x16,0x09,0x28,0x37,0x6A,0x75,0x54,0x4B,
+ 0x99,0x86,0xA7,0xB8,0xE5,0xFA,0xDB,0xC4,0x61,0x7E,0x5F,0x40,0x1D,0x02,0x23,0x3C,
+ 0x5B,0x44,0x65,0x7A,0x27,0x38,0x19,0x06,0xA3,0xBC,0x9D,0x82,0xDF,0xC0,0xE1,0xFE,
+ 0x2C,0x33,0x12,0x0D,0x50,0x4F,0x6E,0x71,0xD4,0xCB,0xEA,0xF5,0xA8,0xB7,0x96,0x89,
+ 0xB5,0xAA,0x8B,0x94,0xC9,0xD6,0xF7,0xE8,0x4D,0x52,0x73,0x6C,0x31,0x2E,0x0F,0x10,
+ 0xC2,0xDD,0xFC,0xE3,0xBE,0xA1,0x80,0x9F,0x3A,0x25,0x04,0x1B,0x46,0x59,0x78,0x67,
+ 0xB6,0xA9,0x88,0x97,0xCA,0xD5,0xF4,0xEB,0x4E,0x51,0x70,0x6F,0x32,0x2D,0x0C,0x13,
+ 0xC1,0xDE,0xFF,0xE0,0xBD,0xA2,0x83,0x9C,0x39,0x26,0x07,0x18,0x45,0x5A,0x7B,0x64,
+ 0x58,0x47,0x66,0x79,0x24,0x3B,0x1A,0x05,0xA0,0xBF,0x9E,0x81,0xDC,0xC3,0xE2,0xFD,
+ 0x2F,0x30,0x11,0x0E,0x53,0x4C,0x6D,0x72,0xD7,0xC8,0xE9,0xF6,0xAB,0xB4,0x95,0x8A,
+ 0xED,0xF2,0xD3,0xCC,0x91,0x8E,0xAF,0xB0,0x15,0x0A,0x2B,0x34,0x69,0x76,0x57,0x48,
+ 0x9A,0x85,0xA4,0xBB,0xE6,0xF9,0xD8,0xC7,0x62,0x7D,0x5C,0x43,0x1E,0x01,0x20,0x3F,
+ 0x03,0x1C,0x3D,0x22,0x7F,0x60,0x41,0x5E,0xFB,0xE4,0xC5,0xDA,0x87,0x98,0xB9,0xA6,
+ 0x74,0x6B,0x4A,0x55,0x08,0x17,0x36,0x29,0x8C,0x93,0xB2,0xAD,0xF0,0xEF,0xCE,0xD1},
+{0x00,0xC3,0x01,0xC2,0x02,0xC1,0x03,0xC0,0x04,0xC7,0x05,0xC6,0x06,0xC5,0x07,0xC4,
+ 0x08,0xCB,0x09,0xCA,0x0A,0xC9,0x0B,0xC8,0x0C,0xCF,0x0D,0xCE,0x0E,0xCD,0x0F,0xCC,
+ 0x10,0xD3,0x11,0xD2,0x12,0xD1,0x13,0xD0,0x14,0xD7,0x15,0xD6,0x16,0xD5,0x17,0xD4,
+ 0x18,0xDB,0x19,0xDA,0x1A,0xD9,0x1B,0xD8,0x1C,0xDF,0x1D,0xDE,0x1E,0xDD,0x1F,0xDC,
+ 0x20,0xE3,0x21,0xE2,0x22,0xE1,0x23,0xE0,0x24,0xE7,0x25,0xE6,0x26,0xE5,0x27,0xE4,
+ 0x28,0xEB,0x29,0xEA,0x2A,0xE9,0x2B,0xE8,0x2C,0xEF,0x2D,0xEE,0x2E,0xED,0x2F,0xEC,
+ 0x30,0xF3,0x31,0xF2,0x32,0xF1,0x33,0xF0,0x34,0xF7,0x35,0xF6,0x36,0xF5,0x37,0xF4,
+ 0x38,0xFB,0x39,0xFA,0x3A,0xF9,0x3B,0xF8,0x3C,0xFF,0x3D,0xFE,0x3E,0xFD,0x3F,0xFC,
+ 0x40,0x83,0x41,0x82,0x42,0x81,0x43,0x80,0x44,0x87,0x45,0x86,0x46,0x85,0x47,0x84,
+ 0x48,0x8B,0x49,0x8A,0x4A,0x89,0x4B,0x88,0x4C,0x8F,0x4D,0x8E,0x4E,0x8D,0x4F,0x8C,
+ 0x50,0x93,0x51,0x92,0x52,0x91,0x53,0x90,0x54,0x97,0x55,0x96,0x56,0x95,0x57,0x94,
+ 0x58,0x9B,0x59,0x9A,0x5A,0x99,0x5B,0x98,0x5C,0x9F,0x5D,0x9E,0x5E,0x9D,0x5F,0x9C,
+ 0x60,0xA3,0x61,0xA2,0x62,0xA1,0x63,0xA0,0x64,0xA7,0x65,0xA6,0x66,0xA5,0x67,0xA4,
+ 0x68,0xAB,0x69,0xAA,0x6A,0xA9,0x6B,0xA8,0x6C,0xAF,0x6D,0xAE,0x6E,0xAD,0x6F,0xAC,
+ 0x70,0xB3,0x71,0xB2,0x72,0xB1,0x73,0xB0,0x74,0xB7,0x75,0xB6,0x76,0xB5,0x77,0xB4,
+ 0x78,0xBB,0x79,0xBA,0x7A,0xB9,0x7B,0xB8,0x7C,0xBF,0x7D,0xBE,0x7E,0xBD,0x7F,0xBC},
+{0x00,0x95,0xAD,0x38,0xDD,0x48,0x70,0xE5,0x3D,0xA8,0x90,0x05,0xE0,0x75,0x4D,0xD8,
+ 0x7A,0xEF,0xD7,0x42,0xA7,0x32,0x0A,0x9F,0x47,0xD2,0xEA,0x7F,0x9A,0x0F,0x37,0xA2,
+ 0xF4,0x61,0x59,0xCC,0x29,0xBC,0x84,0x11,0xC9,0x5C,0x64,0xF1,0x14,0x81,0xB9,0x2C,
+ 0x8E,0x1B,0x23,0xB6,0x53,0xC6,0xFE,0x6B,0xB3,0x26,0x1E,0x8B,0x6E,0xFB,0xC3,0x56,
+ 0x6F,0xFA,0xC2,0x57,0xB2,0x27,0x1F,0x8A,0x52,0xC7,0xFF,0x6A,0x8F,0x1A,0x22,0xB7,
+ 0x15,0x80,0xB8,0x2D,0xC8,0x5D,0x65,0xF0,0x28,0xBD,0x85,0x10,0xF5,0x60,0x58,0xCD,
+ 0x9B,0x0E,0x36,0xA3,0x46,0xD3,0xEB,0x7E,0xA6,0x33,0x0B,0x9E,0x7B,0xEE,0xD6,0x43,
+ 0xE1,0x74,0x4C,0xD9,0x3C,0xA9,0x91,0x04,0xDC,0x49,0x71,0xE4,0x01,0x94,0xAC,0x39,
+ 0xDE,0x4B,0x73,0xE6,0x03,0x96,0xAE,0x3B,0xE3,0x76,0x4E,0xDB,0x3E,0xAB,0x93,0x06,
+ 0xA4,0x31,0x09,0x9C,0x79,0xEC,0xD4,0x41,0x99,0x0C,0x34,0xA1,0x44,0xD1,0xE9,0x7C,
+ 0x2A,0xBF,0x87,0x12,0xF7,0x62,0x5A,0xCF,0x17,0x82,0xBA,0x2F,0xCA,0x5F,0x67,0xF2,
+ 0x50,0xC5,0xFD,0x68,0x8D,0x18,0x20,0xB5,0x6D,0xF8,0xC0,0x55,0xB0,0x25,0x1D,0x88,
+ 0xB1,0x24,0x1C,0x89,0x6C,0xF9,0xC1,0x54,0x8C,0x19,0x21,0xB4,0x51,0xC4,0xFC,0x69,
+ 0xCB,0x5E,0x66,0xF3,0x16,0x83,0xBB,0x2E,0xF6,0x63,0x5B,0xCE,0x2B,0xBE,0x86,0x13,
+ 0x45,0xD0,0xE8,0x7D,0x98,0x0D,0x35,0xA0,0x78,0xED,0xD5,0x40,0xA5,0x30,0x08,0x9D,
+ 0x3F,0xAA,0x92,0x07,0xE2,0x77,0x4F,0xDA,0x02,0x97,0xAF,0x3A,0xDF,0x4A,0x72,0xE7},
+{0x00,0x5F,0xBE,0xE1,0xFB,0xA4,0x45,0x1A,0x71,0x2E,0xCF,0x90,0x8A,0xD5,0x34,0x6B,
+ 0xE2,0xBD,0x5C,0x03,0x19,0x46,0xA7,0xF8,0x93,0xCC,0x2D,0x72,0x68,0x37,0xD6,0x89,
+ 0x43,0x1C,0xFD,0xA2,0xB8,0xE7,0x06,0x59,0x32,0x6D,0x8C,0xD3,0xC9,0x96,0x77,0x28,
+ 0xA1,0xFE,0x1F,0x40,0x5A,0x05,0xE4,0xBB,0xD0,0x8F,0x6E,0x31,0x2B,0x74,0x95,0xCA,
+ 0x86,0xD9,0x38,0x67,0x7D,0x22,0xC3,0x9C,0xF7,0xA8,0x49,0x16,0x0C,0x53,0xB2,0xED,
+ 0x64,0x3B,0xDA,0x85,0x9F,0xC0,0x21,0x7E,0x15,0x4A,0xAB,0xF4,0xEE,0xB1,0x50,0x0F,
+ 0xC5,0x9A,0x7B,0x24,0x3E,0x61,0x80,0xDF,0xB4,0xEB,0x0A,0x55,0x4F,0x10,0xF1,0xAE,
+ 0x27,0x78,0x99,0xC6,0xDC,0x83,0x62,0x3D,0x56,0x09,0xE8,0xB7,0xAD,0xF2,0x13,0x4C,
+ 0x8B,0xD4,0x35,0x6A,0x70,0x2F,0xCE,0x91,0xFA,0xA5,0x44,0x1B,0x01,0x5E,0xBF,0xE0,
+ 0x69,0x36,0xD7,0x88,0x92,0xCD,0x2C,0x73,0x18,0x47,0xA6,0xF9,0xE3,0xBC,0x5D,0x02,
+ 0xC8,0x97,0x76,0x29,0x33,0x6C,0x8D,0xD2,0xB9,0xE6,0x07,0x58,0x42,0x1D,0xFC,0xA3,
+ 0x2A,0x75,0x94,0xCB,0xD1,0x8E,0x6F,0x30,0x5B,0x04,0xE5,0xBA,0xA0,0xFF,0x1E,0x41,
+ 0x0D,0x52,0xB3,0xEC,0xF6,0xA9,0x48,0x17,0x7C,0x23,0xC2,0x9D,0x87,0xD8,0x39,0x66,
+ 0xEF,0xB0,0x51,0x0E,0x14,0x4B,0xAA,0xF5,0x9E,0xC1,0x20,0x7F,0x65,0x3A,0xDB,0x84,
+ 0x4E,0x11,0xF0,0xAF,0xB5,0xEA,0x0B,0x54,0x3F,0x60,0x81,0xDE,0xC4,0x9B,0x7A,0x25,
+ 0xAC,0xF3,0x12,0x4D,0x57,0x08,0xE9,0xB6,0xDD,0x82,0x63,0x3C,0x26,0x79,0x98,0xC7},
+{0x00,0x1D,0x3A,0x27,0x74,0x69,0x4E,0x53,0xE8,0xF5,0xD2,0xCF,0x9C,0x81,0xA6,0xBB,
+ 0x57,0x4A,0x6D,0x70,0x23,0x3E,0x19,0x04,0xBF,0xA2,0x85,0x98,0xCB,0xD6,0xF1,0xEC,
+ 0xAE,0xB3,0x94,0x89,0xDA,0xC7,0xE0,0xFD,0x46,0x5B,0x7C,0x61,0x32,0x2F,0x08,0x15,
+ 0xF9,0xE4,0xC3,0xDE,0x8D,0x90,0xB7,0xAA,0x11,0x0C,0x2B,0x36,0x65,0x78,0x5F,0x42,
+ 0xDB,0xC6,0xE1,0xFC,0xAF,0xB2,0x95,0x88,0x33,0x2E,0x09,0x14,0x47,0x5A,0x7D,0x60,
+ 0x8C,0x91,0xB6,0xAB,0xF8,0xE5,0xC2,0xDF,0x64,0x79,0x5E,0x43,0x10,0x0D,0x2A,0x37,
+ 0x75,0x68,0x4F,0x52,0x01,0x1C,0x3B,0x26,0x9D,0x80,0xA7,0xBA,0xE9,0xF4,0xD3,0xCE,
+ 0x22,0x3F,0x18,0x05,0x56,0x4B,0x6C,0x71,0xCA,0xD7,0xF0,0xED,0xBE,0xA3,0x84,0x99,
+ 0x31,0x2C,0x0B,0x16,0x45,0x58,0x7F,0x62,0xD9,0xC4,0xE3,0xFE,0xAD,0xB0,0x97,0x8A,
+ 0x66,0x7B,0x5C,0x41,0x12,0x0F,0x28,0x35,0x8E,0x93,0xB4,0xA9,0xFA,0xE7,0xC0,0xDD,
+ 0x9F,0x82,0xA5,0xB8,0xEB,0xF6,0xD1,0xCC,0x77,0x6A,0x4D,0x50,0x03,0x1E,0x39,0x24,
+ 0xC8,0xD5,0xF2,0xEF,0xBC,0xA1,0x86,0x9B,0x20,0x3D,0x1A,0x07,0x54,0x49,0x6E,0x73,
+ 0xEA,0xF7,0xD0,0xCD,0x9E,0x83,0xA4,0xB9,0x02,0x1F,0x38,0x25,0x76,0x6B,0x4C,0x51,
+ 0xBD,0xA0,0x87,0x9A,0xC9,0xD4,0xF3,0xEE,0x55,0x48,0x6F,0x72,0x21,0x3C,0x1B,0x06,
+ 0x44,0x59,0x7E,0x63,0x30,0x2D,0x0A,0x17,0xAC,0xB1,0x96,0x8B,0xD8,0xC5,0xE2,0xFF,
+ 0x13,0x0E,0x29,0x34,0x67,0x7A,0x5D,0x40,0xFB,0xE6,0xC1,0xDC,0x8F,0x92,0xB5,0xA8},
+{0x00,0x1E,0x3C,0x22,0x78,0x66,0x44,0x5A,0xF0,0xEE,0xCC,0xD2,0x88,0x96,0xB4,0xAA,
+ 0x67,0x79,0x5B,0x45,0x1F,0x01,0x23,0x3D,0x97,0x89,0xAB,0xB5,0xEF,0xF1,0xD3,0xCD,
+ 0xCE,0xD0,0xF2,0xEC,0xB6,0xA8,0x8A,0x94,0x3E,0x20,0x02,0x1C,0x46,0x58,0x7A,0x64,
+ 0xA9,0xB7,0x95,0x8B,0xD1,0xCF,0xED,0xF3,0x59,0x47,0x65,0x7B,0x21,0x3F,0x1D,0x03,
+ 0x1B,0x05,0x27,0x39,0x63,0x7D,0x5F,0x41,0xEB,0xF5,0xD7,0xC9,0x93,0x8D,0xAF,0xB1,
+ 0x7C,0x62,0x40,0x5E,0x04,0x1A,0x38,0x26,0x8C,0x92,0xB0,0xAE,0xF4,0xEA,0xC8,0xD6,
+ 0xD5,0xCB,0xE9,0xF7,0xAD,0xB3,0x91,0x8F,0x25,0x3B,0x19,0x07,0x5D,0x43,0x61,0x7F,
+ 0xB2,0xAC,0x8E,0x90,0xCA,0xD4,0xF6,0xE8,0x42,0x5C,0x7E,0x60,0x3A,0x24,0x06,0x18,
+ 0x36,0x28,0x0A,0x14,0x4E,0x50,0x72,0x6C,0xC6,0xD8,0xFA,0xE4,0xBE,0xA0,0x82,0x9C,
+ 0x51,0x4F,0x6D,0x73,0x29,0x37,0x15,0x0B,0xA1,0xBF,0x9D,0x83,0xD9,0xC7,0xE5,0xFB,
+ 0xF8,0xE6,0xC4,0xDA,0x80,0x9E,0xBC,0xA2,0x08,0x16,0x34,0x2A,0x70,0x6E,0x4C,0x52,
+ 0x9F,0x81,0xA3,0xBD,0xE7,0xF9,0xDB,0xC5,0x6F,0x71,0x53,0x4D,0x17,0x09,0x2B,0x35,
+ 0x2D,0x33,0x11,0x0F,0x55,0x4B,0x69,0x77,0xDD,0xC3,0xE1,0xFF,0xA5,0xBB,0x99,0x87,
+ 0x4A,0x54,0x76,0x68,0x32,0x2C,0x0E,0x10,0xBA,0xA4,0x86,0x98,0xC2,0xDC,0xFE,0xE0,
+ 0xE3,0xFD,0xDF,0xC1,0x9B,0x85,0xA7,0xB9,0x13,0x0D,0x2F,0x31,0x6B,0x75,0x57,0x49,
+ 0x84,0x9A,0xB8,0xA6,0xFC,0xE2,0xC0,0xDE,0x74,0x6A,0x48,0x56,0x0C,0x12,0x30,0x2E},
+};
+
 static inline int mod255(int x)
 {
 	while(x >= 255)
@@ -99,6 +1132,38 @@ void encode_rs_8(uint8_t *data, uint8_t *parity, int pad)
 	}
 }
 
+/* Table driven version, bit-exact with encode_rs_8(). The parity register
+ * is kept circular, so the shift is just an increment of the head index.
+ * "ssdv -b" (tools/ssdv) compares its speed with encode_rs_8(). */
+void encode_rs_8_fast(uint8_t *data, uint8_t *parity, int pad)
+{
+	int i, j, h;
+	uint8_t reg[NROOTS];
+	const uint8_t *g;
+	
+	memset(reg, 0, NROOTS * sizeof(uint8_t));
+	
+	for(i = 0, h = 0; i < NN - NROOTS - pad; i++)
+	{
+		/* Row of zeros if the feedback term is zero */
+		g = GENMUL[data[i] ^ reg[h]];
+		
+		/* The register wraps at h, XOR the two contiguous parts */
+		for(j = h + 1; j < NROOTS; j++)
+			reg[j] ^= g[j - h];
+		for(j = 0; j < h; j++)
+			reg[j] ^= g[j + NROOTS - h];
+		
+		/* The leaving symbol's slot becomes the last parity symbol */
+		reg[h] = g[0];
+		h = (h + 1) & (NROOTS - 1);
+	}
+	
+	/* Unroll the register */
+	for(j = 0; j < NROOTS; j++)
+		parity[j] = reg[(h + j) & (NROOTS - 1)];
+}
+
 int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 {
 	int deg_lambda, el, deg_omega;
@@ -316,3 +1381,224 @@ finish:
 	return(count);
 }
 
+/* Reduce x modulo NN, for 0 <= x < 2 * NN */
+#define MODNN2(x) ((x) >= NN ? (x) - NN : (x))
+
+/* Faster version of decode_rs_8(), with the same results. The syndromes
+ * are evaluated with one table lookup per symbol and root, the rest of
+ * the decoder (only run when a syndrome is non-zero) reduces with a single
+ * subtract instead of mod255(). The Chien search only steps the non-zero
+ * terms of the locator. */
+int decode_rs_8_fast(uint8_t *data, int *eras_pos, int no_eras, int pad)
+{
+	int deg_lambda, el, deg_omega;
+	int i, j, r, k, x;
+	uint8_t u, q, tmp, num1, num2, den, discr_r;
+	uint8_t lambda[NROOTS + 1], s[NROOTS]; /* Err+Eras Locator poly
+	                                        * and syndrome poly */
+	uint8_t b[NROOTS + 1], t[NROOTS + 1], omega[NROOTS + 1];
+	uint8_t root[NROOTS], reg[NROOTS + 1], loc[NROOTS];
+	int syn_error, count;
+	
+	if(pad < 0 || pad > 222) return(-1);
+	
+	/* form the syndromes; i.e., evaluate data(x) at roots of g(x) */
+	for(i = 0; i < NROOTS; i++) s[i] = data[0];
+	
+	for(j = 1; j < NN - pad; j++)
+	{
+		for(i = 0; i < NROOTS; i++)
+		{
+			s[i] = data[j] ^ SYNMUL[i][s[i]];
+		}
+	}
+	
+	/* Convert syndromes to index form, checking for nonzero condition */
+	syn_error = 0;
+	for(i = 0; i < NROOTS; i++)
+	{
+		syn_error |= s[i];
+		s[i] = INDEX_OF[s[i]];
+	}
+	
+	if(!syn_error)
+	{
+		/* data[] is a codeword, nothing to correct */
+		count = 0;
+		goto finish;
+	}
+	
+	memset(&lambda[1], 0, NROOTS * sizeof(lambda[0]));
+	lambda[0] = 1;
+	
+	if(no_eras > 0)
+	{
+		/* Init lambda to be the erasure locator polynomial */
+		lambda[1] = ALPHA_TO[MODNN(PRIM * (NN - 1 - eras_pos[0]))];
+		for(i = 1; i < no_eras; i++)
+		{
+			u = MODNN(PRIM * (NN - 1 - eras_pos[i]));
+			for(j = i + 1; j > 0; j--)
+			{
+				tmp = INDEX_OF[lambda[j - 1]];
+				if(tmp != A0) lambda[j] ^= ALPHA_TO[MODNN2(u + tmp)];
+			}
+		}
+	}
+	
+	for(i = 0; i < NROOTS + 1; i++)
+		b[i] = INDEX_OF[lambda[i]];
+	
+	/* Berlekamp-Massey algorithm to determine error+erasure locator polynomial */
+	r = no_eras;
+	el = no_eras;
+	while(++r <= NROOTS) /* r is the step number */
+	{
+		/* Compute discrepancy at the r-th step in poly-form */
+		discr_r = 0;
+		for(i = 0; i < r; i++)
+		{
+			if((lambda[i] != 0) && (s[r - i - 1] != A0))
+			{
+				x = INDEX_OF[lambda[i]] + s[r - i - 1];
+				discr_r ^= ALPHA_TO[MODNN2(x)];
+			}
+		}
+		discr_r = INDEX_OF[discr_r]; /* Index form */
+		if(discr_r == A0)
+		{
+			/* B(x) <-- x*B(x) */
+			memmove(&b[1], b, NROOTS * sizeof(b[0]));
+			b[0] = A0;
+		}
+		else
+		{
+			/* T(x) <-- lambda(x) - discr_r*x*b(x) */
+			t[0] = lambda[0];
+			for(i = 0; i < NROOTS; i++)
+			{
+				if(b[i] != A0)
+				{
+					x = discr_r + b[i];
+					t[i + 1] = lambda[i + 1] ^ ALPHA_TO[MODNN2(x)];
+				}
+				else
+					t[i + 1] = lambda[i + 1];
+			}
+			
+			if(2 * el <= r + no_eras - 1)
+			{
+				el = r + no_eras - el;
+				/* B(x) <-- inv(discr_r) * lambda(x) */
+				for(i = 0; i <= NROOTS; i++)
+				{
+					x = INDEX_OF[lambda[i]] - discr_r + NN;
+					b[i] = (lambda[i] == 0) ? A0 : MODNN2(x);
+				}
+			}
+			else
+			{
+				/* B(x) <-- x*B(x) */
+				memmove(&b[1], b, NROOTS * sizeof(b[0]));
+				b[0] = A0;
+			}
+			
+			memcpy(lambda, t, (NROOTS + 1) * sizeof(t[0]));
+		}
+	}
+	
+	/* Convert lambda to index form and compute deg(lambda(x)) */
+	deg_lambda = 0;
+	for(i = 0; i < NROOTS + 1; i++)
+	{
+		lambda[i] = INDEX_OF[lambda[i]];
+		if(lambda[i] != A0) deg_lambda = i;
+	}
+	
+	/* Find roots of the error+erasure locator polynomial by Chien search.
+	 * Only the non-zero terms are stepped, j is always below NN. */
+	count = 0; /* Number of roots of lambda(x) */
+	for(i = 0, el = 0; i < deg_lambda; i++)
+	{
+		if(lambda[i + 1] == A0) continue;
+		reg[el] = lambda[i + 1];
+		t[el++] = i + 1;
+	}
+	
+	for(i = 1, k = IPRIM - 1; i <= NN; i++, k = MODNN2(k + IPRIM))
+	{
+		q = 1; /* lambda[0] is always 0 */
+		for(j = 0; j < el; j++)
+		{
+			x = reg[j] + t[j];
+			reg[j] = MODNN2(x);
+			q ^= ALPHA_TO[reg[j]];
+		}
+		
+		if(q != 0) continue; /* Not a root */
+		
+		/* store root (index-form) and error location number */
+		root[count] = i;
+		loc[count] = k;
+		
+		/* If we've already found max possible roots, stop */
+		if(++count == deg_lambda) break;
+	}
+	
+	if(deg_lambda != count)
+	{
+		/* deg(lambda) unequal to number of roots => uncorrectable error */
+		count = -1;
+		goto finish;
+	}
+	
+	/* Compute err+eras evaluator poly omega(x) = s(x)*lambda(x) (modulo
+	 * x**NROOTS). in index form. Also find deg(omega). */
+	deg_omega = deg_lambda - 1;
+	for(i = 0; i <= deg_omega; i++)
+	{
+		tmp = 0;
+		for(j = i; j >= 0; j--)
+		{
+			if((s[i - j] != A0) && (lambda[j] != A0))
+			{
+				x = s[i - j] + lambda[j];
+				tmp ^= ALPHA_TO[MODNN2(x)];
+			}
+		}
+		omega[i] = INDEX_OF[tmp];
+	}
+	
+	/* Compute error values in poly-form. num1 = omega(inv(X(l))), num2 =
+	 * inv(X(l))**(FCR-1) and den = lambda_pr(inv(X(l))) all in poly-form */
+	for(j = count - 1; j >= 0; j--)
+	{
+		num1 = 0;
+		for(i = deg_omega; i >= 0; i--)
+		{
+			if(omega[i] != A0) num1 ^= ALPHA_TO[MODNN(omega[i] + i * root[j])];
+		}
+		num2 = ALPHA_TO[MODNN(root[j] * (FCR - 1) + NN)];
+		den = 0;
+		
+		/* lambda[i+1] for i even is the formal derivative lambda_pr of lambda[i] */
+		for(i = MIN(deg_lambda, NROOTS - 1) & ~1; i >= 0; i -= 2)
+		{
+			if(lambda[i + 1] != A0) den ^= ALPHA_TO[MODNN(lambda[i + 1] + i * root[j])];
+		}
+		
+		/* Apply error to data */
+		if(num1 != 0 && loc[j] >= pad)
+		{
+			data[loc[j] - pad] ^= ALPHA_TO[MODNN(INDEX_OF[num1] + INDEX_OF[num2] + NN - INDEX_OF[den])];
+		}
+	}
+	
+finish:
+	if(eras_pos != NULL)
+	{
+		for(i = 0; i < count; i++) eras_pos[i] = loc[i];
+	}
+	
+	return(count);
+}
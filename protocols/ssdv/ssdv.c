@@ -21,6 +21,7 @@
 #include <string.h>
 #include "ssdv.h"
 #include "rs8.h"
+#include "crc32.h"
 #include "debug.h"
 
 /* Recognised JPEG markers */
@@ -154,25 +155,6 @@ static void *dtblcpy(ssdv_t *s, const void *src, size_t n)
 	return(r);
 }
 
-static uint32_t crc32(void *data, size_t length)
-{
-	uint32_t crc, x;
-	uint8_t i, *d;
-	
-	for(d = data, crc = 0xFFFFFFFF; length; length--)
-	{
-		x = (crc ^ *(d++)) & 0xFF;
-		for(i = 8; i > 0; i--)
-		{
-			if(x & 1) x = (x >> 1) ^ 0xEDB88320;
-			else x >>= 1;
-		}
-		crc = (crc >> 8) ^ x;
-	}
-	
-	return(crc ^ 0xFFFFFFFF);
-}
-
 static uint32_t encode_callsign(char *callsign)
 {
 	uint32_t x;
@@ -359,6 +341,32 @@ static char ssdv_out_jpeg_int(ssdv_t *s, uint8_t rle, int value)
 	return(SSDV_OK);
 }
 
+static void ssdv_stats_block(ssdv_t *s)
+{
+	/* The absolute DC value of the luma block, 8 * (average - 128). It is
+	 * only kept dequantised if the source and output tables differ. */
+	int32_t dc = s->dc[0];
+	if(s->sdqt[0][1] == s->ddqt[0][1]) dc *= s->sdqt[0][1];
+	
+	s->stats->blocks++;
+	s->stats->dc_sum += dc;
+	s->stats->dc_sqsum += (int64_t) dc * dc;
+}
+
+static void ssdv_stats_mcu(ssdv_t *s)
+{
+	uint16_t row_mcus = s->width >> (s->mcu_mode <= 1 ? 4 : 3);
+	
+	/* Classify each completed MCU row by its entropy coded size */
+	if(row_mcus == 0 || s->mcu_id % row_mcus != 0) return;
+	
+	if(s->stats->bits - s->stats->row_bits < (uint32_t) SSDV_STATS_FLAT_BITS * row_mcus)
+		s->stats->flat_rows++;
+	
+	s->stats->rows++;
+	s->stats->row_bits = s->stats->bits;
+}
+
 static char ssdv_process(ssdv_t *s)
 {
 	if(s->state == S_HUFF)
@@ -370,6 +378,8 @@ static char ssdv_process(ssdv_t *s)
 		if((r = jpeg_dht_lookup(s, &symbol, &width)) != SSDV_OK)
 			return(r);
 		
+		if(s->stats) s->stats->bits += width;
+		
 		if(s->acpart == 0) /* DC */
 		{
 			if(symbol == 0x00)
@@ -434,6 +444,7 @@ static char ssdv_process(ssdv_t *s)
 		
 		/* Decode the integer */
 		i = jpeg_int(s->workbits >> (s->worklen - s->needbits), s->needbits);
+		if(s->stats) s->stats->bits += s->needbits;
 		
 		if(s->acpart == 0) /* DC */
 		{
@@ -511,11 +522,15 @@ static char ssdv_process(ssdv_t *s)
 	if(s->acpart >= 64)
 	{
 		/* Reached the end of this MCU part */
+		if(s->stats && s->component == 0) ssdv_stats_block(s);
+		
 		if(++s->mcupart == s->ycparts + 2)
 		{
 			s->mcupart = 0;
 			s->mcu_id++;
 			
+			if(s->stats) ssdv_stats_mcu(s);
+			
 			/* Test for the end of image */
 			if(s->mcu_id >= s->mcu_count)
 			{
@@ -993,7 +1008,7 @@ char ssdv_enc_get_packet(ssdv_t *s)
 				
 				/* Generate the RS codes */
 				if(s->type == SSDV_TYPE_NORMAL)
-					encode_rs_8(&s->out[1], &s->out[i], 0);
+					encode_rs_8_fast(&s->out[1], &s->out[i], 0);
 				
 				s->packet_id++;
 				
@@ -1027,6 +1042,13 @@ char ssdv_enc_feed(ssdv_t *s, uint8_t *buffer, size_t length)
 	return(SSDV_OK);
 }
 
+char ssdv_enc_set_stats(ssdv_t *s, ssdv_stats_t *stats)
+{
+	memset(stats, 0, sizeof(ssdv_stats_t));
+	s->stats = stats;
+	return(SSDV_OK);
+}
+
 /*****************************************************************************/
 
 static void ssdv_write_marker(ssdv_t *s, uint16_t id, uint16_t length, const uint8_t *data)
@@ -1319,7 +1341,7 @@ char ssdv_dec_is_packet(uint8_t *packet, int *errors)
 		
 		/* Run the reed-solomon decoder */
 		pkt[1] = 0x66 + SSDV_TYPE_NORMAL;
-		i = decode_rs_8(&pkt[1], 0, 0, 0);
+		i = decode_rs_8_fast(&pkt[1], 0, 0, 0);
 		
 		if(i < 0) return(-1); /* Reed-solomon decoder failed */
 		if(errors) *errors = i;
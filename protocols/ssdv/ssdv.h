@@ -45,6 +45,20 @@ extern "C" {
 #define SSDV_TYPE_NORMAL (0)
 #define SSDV_TYPE_NOFEC  (1)
 
+#define SSDV_STATS_FLAT_BITS (80) /* MCU rows below this many bits per MCU count as flat */
+
+/* Image statistics gathered by the encoder, without decoding the image */
+typedef struct
+{
+	uint32_t bits;      /* Entropy coded bits of the image               */
+	uint32_t blocks;    /* Number of luma blocks                         */
+	int32_t  dc_sum;    /* Sum of the luma DC values                     */
+	uint64_t dc_sqsum;  /* Sum of the squared luma DC values             */
+	uint16_t rows;      /* Number of MCU rows                            */
+	uint16_t flat_rows; /* Number of MCU rows with little detail         */
+	uint32_t row_bits;  /* Bits at the start of the current MCU row      */
+} ssdv_stats_t;
+
 typedef struct
 {
 	/* Packet type configuration */
@@ -112,6 +126,7 @@ typedef struct
 	} mode;
 	uint32_t reset_mcu; /* MCU block to do absolute encoding            */
 	char needbits;      /* Number of bits needed to decode integer      */
+	ssdv_stats_t *stats; /* Image statistics (encoder only, optional)   */
 	
 	/* The input huffman and quantisation tables */
 	uint8_t stbls[TBL_LEN + HBUFF_LEN];
@@ -145,6 +160,7 @@ extern char ssdv_enc_init(ssdv_t *s, uint8_t type, char *callsign, uint8_t image
 extern char ssdv_enc_set_buffer(ssdv_t *s, uint8_t *buffer);
 extern char ssdv_enc_get_packet(ssdv_t *s);
 extern char ssdv_enc_feed(ssdv_t *s, uint8_t *buffer, size_t length);
+extern char ssdv_enc_set_stats(ssdv_t *s, ssdv_stats_t *stats);
 
 /* Decoding */
 extern char ssdv_dec_init(ssdv_t *s);
@@ -257,7 +257,9 @@ void send2GFSK(radio_t radio, radioMSG_t *msg) {
   * been received.
   */
 uint32_t getAPRSRegionFrequency2m(void) {
-	trackPoint_t *point = getLastTrackPoint();
+	trackPoint_t tp;
+	trackPoint_t *point = &tp;
+	getLastTrackPoint(point);
 
 	// Use this frequency for the rest of the world (unset regions, 144.800 MHz)
 	uint32_t freq = APRS_FREQ_OTHER;
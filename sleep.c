@@ -70,11 +70,6 @@ systime_t waitForTrigger(systime_t prev, trigger_config_t *config)
 
 void trigger_new_tracking_point(void)
 {
-	uint32_t oldID = getLastTrackPoint()->id;
-	trackPoint_t *newtp;
-	do { // Wait for new serial ID to be deployed
-		chThdSleepMilliseconds(100);
-		newtp = getLastTrackPoint();
-	} while(newtp->id == oldID);
+	waitForNewTrackPoint();
 }
 
@@ -0,0 +1,286 @@
+
+/* Base91/Base64 test and benchmark                                      */
+/*=======================================================================*/
+/* Checks the encoders of math/base.c against the previous 64 bit queue  */
+/* implementation and the decoders against the encoders, on random data  */
+/* and on the SSDV packets of the JPEG images given on the command line. */
+/* Then times both implementations.                                      */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "base.h"
+#include "ssdv.h"
+
+#define MAX_LEN     (512)
+#define APRS_PAYLOAD (SSDV_PKT_SIZE - 37) /* Sync byte, CRC and FEC not transmitted */
+
+int ssdv_verbose = 0;
+
+extern const unsigned char b91_table[91];
+
+static uint32_t prng = 0x2F6E2B1;
+static int failed = 0;
+
+static uint32_t rnd(void)
+{
+	prng ^= prng << 13;
+	prng ^= prng >> 17;
+	prng ^= prng << 5;
+	return(prng);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Previous implementation with a 64 bit queue, used as reference */
+static size_t ref_base91_encode(const uint8_t *in, uint8_t *out, size_t len)
+{
+	uint64_t queue = 0, nbits = 0;
+	size_t n = 0;
+
+	while(len--)
+	{
+		queue |= *in++ << nbits;
+		nbits += 8;
+		if(nbits > 13)
+		{
+			uint32_t val = queue & 8191;
+
+			if(val > 88) {
+				queue >>= 13;
+				nbits -= 13;
+			} else {
+				val = queue & 16383;
+				queue >>= 14;
+				nbits -= 14;
+			}
+			out[n++] = b91_table[val % 91];
+			out[n++] = b91_table[val / 91];
+		}
+	}
+	if(nbits)
+	{
+		out[n++] = b91_table[queue % 91];
+		if(nbits > 7 || queue > 90)
+			out[n++] = b91_table[queue / 91];
+	}
+
+	return(n);
+}
+
+static void ref_base64_encode(const uint8_t *in, uint8_t *out, size_t len)
+{
+	static const char t[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	static const int mod[] = {0, 2, 1};
+	size_t i, j;
+
+	for(i = 0, j = 0; i < len;)
+	{
+		uint32_t a = i < len ? in[i++] : 0;
+		uint32_t b = i < len ? in[i++] : 0;
+		uint32_t c = i < len ? in[i++] : 0;
+		uint32_t triple = (a << 16) + (b << 8) + c;
+
+		out[j++] = t[(triple >> 18) & 0x3F];
+		out[j++] = t[(triple >> 12) & 0x3F];
+		out[j++] = t[(triple >> 6) & 0x3F];
+		out[j++] = t[triple & 0x3F];
+	}
+	for(i = 0; i < (size_t) mod[len % 3]; i++)
+		out[BASE64LEN(len) - 1 - i] = '=';
+	out[BASE64LEN(len)] = '\0';
+}
+
+static void fail(const char *what, size_t len)
+{
+	if(failed++ < 10) fprintf(stderr, "FAIL: %s (%zu bytes)\n", what, len);
+}
+
+/* All checks on one payload */
+static void check(const uint8_t *in, size_t len)
+{
+	uint8_t enc[BASE64LEN(MAX_LEN) + 8], ref[BASE64LEN(MAX_LEN) + 8], dec[MAX_LEN + 8];
+	size_t n, m, k, i;
+	base91_t b;
+
+	/* Base91 */
+	n = base91_encode(in, enc, len);
+	m = ref_base91_encode(in, ref, len);
+	if(n != m || memcmp(enc, ref, n)) fail("base91_encode() differs from reference", len);
+	if(n > (size_t) BASE91LEN(len)) fail("base91_encode() longer than BASE91LEN()", len);
+
+	k = base91_decode(enc, dec, n);
+	if(k != len || memcmp(dec, in, len)) fail("base91_decode() round trip", len);
+
+	/* Streaming, as done into the AX.25 framer */
+	basE91_init(&b);
+	for(i = 0, m = 0; i < len; i++)
+		m += basE91_encode_byte(&b, in[i], &ref[m]);
+	m += basE91_encode_end(&b, &ref[m]);
+	if(n != m || memcmp(enc, ref, n)) fail("basE91_encode_byte() differs from base91_encode()", len);
+
+	/* Decoder input split in the middle of a character pair */
+	if(n >= 2)
+	{
+		basE91_init(&b);
+		k = basE91_decode(&b, enc, n / 3 | 1, dec);
+		k += basE91_decode(&b, enc + (n / 3 | 1), n - (n / 3 | 1), dec + k);
+		k += basE91_decode_end(&b, dec + k);
+		if(k != len || memcmp(dec, in, len)) fail("basE91_decode() split input", len);
+	}
+
+	/* Base64 */
+	base64_encode(in, enc, len);
+	ref_base64_encode(in, ref, len);
+	if(strcmp((char*) enc, (char*) ref)) fail("base64_encode() differs from reference", len);
+
+	k = base64_decode(enc, dec, BASE64LEN(len));
+	if(k != len || memcmp(dec, in, len)) fail("base64_decode() round trip", len);
+}
+
+/* Encodes a JPEG to SSDV packets the way the IMG module does */
+static int ssdv_payloads(const char *filename, uint8_t **pkts)
+{
+	uint8_t buf[128], pkt[SSDV_PKT_SIZE];
+	ssdv_t ssdv;
+	FILE *f;
+	int n = 0, size = 0;
+	size_t r;
+	char c;
+
+	f = fopen(filename, "rb");
+	if(!f)
+	{
+		perror(filename);
+		return(-1);
+	}
+
+	ssdv_enc_init(&ssdv, SSDV_TYPE_NORMAL, "PECAN", 0);
+	ssdv_enc_set_buffer(&ssdv, pkt);
+
+	while(1)
+	{
+		while((c = ssdv_enc_get_packet(&ssdv)) == SSDV_FEED_ME)
+		{
+			r = fread(buf, 1, sizeof(buf), f);
+			if(r == 0) break;
+			ssdv_enc_feed(&ssdv, buf, r);
+		}
+		if(c != SSDV_OK) break;
+
+		if(n == size)
+		{
+			size = size ? size * 2 : 64;
+			*pkts = realloc(*pkts, size * APRS_PAYLOAD);
+		}
+		memcpy(*pkts + n * APRS_PAYLOAD, &pkt[1], APRS_PAYLOAD);
+		n++;
+	}
+
+	fclose(f);
+	return(n);
+}
+
+static void bench(const char *name, const uint8_t *data, int n, size_t len, int rounds)
+{
+	uint8_t out[BASE64LEN(MAX_LEN) + 8], dec[MAX_LEN + 8];
+	size_t enc_len[2];
+	double t, t91, t91ref, t64, d91, d64;
+	int r, i;
+	double mb = (double) n * rounds * len / 1e6;
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			enc_len[0] = base91_encode(&data[i * len], out, len);
+	t91 = now() - t;
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			ref_base91_encode(&data[i * len], out, len);
+	t91ref = now() - t;
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			base91_decode(out, dec, enc_len[0]);
+	d91 = now() - t;
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			base64_encode(&data[i * len], out, len);
+	t64 = now() - t;
+	enc_len[1] = BASE64LEN(len);
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			base64_decode(out, dec, enc_len[1]);
+	d64 = now() - t;
+
+	printf("%s, %i x %zu bytes:\n", name, n, len);
+	printf("  base91 encode %7.1f MB/s (64 bit queue %7.1f MB/s), decode %7.1f MB/s\n", mb / t91, mb / t91ref, mb / d91);
+	printf("  base64 encode %7.1f MB/s, decode %7.1f MB/s\n", mb / t64, mb / d64);
+}
+
+int main(int argc, char *argv[])
+{
+	uint8_t *data, *pkts = NULL, *p = NULL;
+	size_t len;
+	int i, n, total = 0;
+
+	/* Random payloads of every length up to MAX_LEN, covering the LOG
+	 * and ERR payloads too, and a few runs of constant bytes */
+	data = malloc(MAX_LEN);
+	for(len = 0; len <= MAX_LEN; len++)
+	{
+		for(i = 0; i < 8; i++)
+		{
+			size_t j;
+			for(j = 0; j < len; j++) data[j] = rnd();
+			check(data, len);
+		}
+		memset(data, 0x00, len); check(data, len);
+		memset(data, 0xFF, len); check(data, len);
+	}
+	printf("Random payloads:     0 to %i bytes, %s\n", MAX_LEN, failed ? "FAILED" : "ok");
+
+	/* SSDV payloads as transmitted by APRS */
+	for(i = 1; i < argc; i++)
+	{
+		n = ssdv_payloads(argv[i], &p);
+		if(n < 0) return(-1);
+
+		pkts = realloc(pkts, (total + n) * APRS_PAYLOAD);
+		memcpy(pkts + total * APRS_PAYLOAD, p, n * APRS_PAYLOAD);
+		total += n;
+	}
+	for(i = 0; i < total; i++)
+		check(&pkts[i * APRS_PAYLOAD], APRS_PAYLOAD);
+	if(total)
+		printf("SSDV payloads:       %i packets, %s\n", total, failed ? "FAILED" : "ok");
+
+	/* Timing */
+	for(i = 0; i < MAX_LEN; i++) data[i] = rnd();
+	bench("Random", data, 1, MAX_LEN, 20000);
+	if(total)
+		bench("SSDV", pkts, total, APRS_PAYLOAD, 20000 / total + 1);
+
+	free(data);
+	free(pkts);
+	free(p);
+
+	return(failed ? -1 : 0);
+}
+
@@ -0,0 +1,18 @@
+/* Host replacement for ChibiOS, so the BME280 driver can be built on a PC. */
+/* Sleeping advances the simulated sensor to its next measurement.         */
+
+#ifndef __CH_H__
+#define __CH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint32_t systime_t;
+
+#define S2ST(s)		((systime_t)(s) * 1000)
+
+void chThdSleepMilliseconds(uint32_t ms);
+systime_t chVTGetSystemTimeX(void);
+systime_t chVTTimeElapsedSinceX(systime_t start);
+
+#endif
@@ -0,0 +1,6 @@
+/* Host replacement for the ChibiOS HAL (nothing needed by the driver) */
+
+#ifndef __HAL_H__
+#define __HAL_H__
+
+#endif
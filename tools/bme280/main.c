@@ -0,0 +1,299 @@
+/* BME280 pressure accuracy check                                         */
+/*=======================================================================*/
+/* Runs drivers/bme280.c against a simulated sensor which replays raw    */
+/* measurements and compares BME280_getPressure (raw values averaged,    */
+/* compensated once) with the previous path (every measurement           */
+/* compensated, results averaged). Then the sensor stops measuring and   */
+/* every failed probe has to double the retry backoff exactly once.      */
+/*                                                                       */
+/* Usage: bme280 [recording]                                             */
+/*                                                                       */
+/* A recording holds one measurement per line as decimal raw values      */
+/* "adc_P adc_T adc_H". A line "calib" followed by the 33 hex bytes of   */
+/* the registers 0x88..0xA1 and 0xE1..0xE7 sets the calibration. Lines   */
+/* starting with # are ignored. Without a recording, the calibration     */
+/* example of the datasheet and a synthetic ascent are used.             */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bme280.h"
+#include "pi2c.h"
+
+#define MAX_SAMPLES		100000
+#define TOLERANCE		5		/* Max. deviation in Pa*10, below the sensor noise */
+
+typedef struct {
+	int32_t adc_P;
+	int32_t adc_T;
+	int32_t adc_H;
+} sample_t;
+
+static uint8_t regs[256];				// Register file of the simulated sensor
+static sample_t samples[MAX_SAMPLES];
+static uint32_t nsamples;
+static uint32_t cur;					// Measurement in the data registers
+static uint32_t transactions;
+static bool skipping;					// Sensor not measuring (e.g. power cycled)
+
+static uint32_t prng = 0x2F6E2B1;
+
+static uint32_t rnd(void)
+{
+	prng ^= prng << 13;
+	prng ^= prng >> 17;
+	prng ^= prng << 5;
+	return(prng);
+}
+
+/* Simulated sensor ---------------------------------------------------- */
+
+static void load_data_regs(void)
+{
+	const sample_t *s = &samples[cur < nsamples ? cur : nsamples-1];
+	int32_t adc_P = skipping ? BME280_SKIPPED : s->adc_P;
+
+	regs[0xF7] = adc_P >> 12;
+	regs[0xF8] = adc_P >> 4;
+	regs[0xF9] = adc_P << 4;
+	regs[0xFA] = s->adc_T >> 12;
+	regs[0xFB] = s->adc_T >> 4;
+	regs[0xFC] = s->adc_T << 4;
+	regs[0xFD] = s->adc_H >> 8;
+	regs[0xFE] = s->adc_H;
+}
+
+static systime_t now;					// Simulated time in ms
+
+void chThdSleepMilliseconds(uint32_t ms)
+{
+	uint32_t n = ms / BME280_MEAS_TIME;
+	cur += n ? n : 1;
+	now += ms;
+	load_data_regs();
+}
+
+systime_t chVTGetSystemTimeX(void)
+{
+	return now;
+}
+
+systime_t chVTTimeElapsedSinceX(systime_t start)
+{
+	return now - start;
+}
+
+bool I2C_write8(uint8_t address, uint8_t reg, uint8_t value)
+{
+	(void)address;
+	(void)reg;
+	(void)value;
+	transactions++;
+	return true;
+}
+
+bool I2C_readN(uint8_t address, uint8_t reg, uint8_t *rxbuf, uint32_t length)
+{
+	(void)address;
+	transactions++;
+	for(uint32_t i=0; i<length; i++)
+		rxbuf[i] = regs[(reg + i) & 0xFF];
+	return true;
+}
+
+bool I2C_read8(uint8_t address, uint8_t reg, uint8_t *val)
+{
+	return I2C_readN(address, reg, val, 1);
+}
+
+/* Previous path: every measurement compensated, results averaged ------- */
+
+static uint32_t ref_pressure(const bme280_calib_data_t *c, const sample_t *s, uint16_t means)
+{
+	int64_t var1, var2, p;
+	uint64_t sum = 0;
+
+	for(uint16_t i=0; i<means; i++) {
+		int32_t adc_T = s[i].adc_T;
+		int32_t t_fine;
+
+		var1 = ((((adc_T>>3) - ((int32_t)c->dig_T1 <<1))) * ((int32_t)c->dig_T2)) >> 11;
+		var2 = (((((adc_T>>4) - ((int32_t)c->dig_T1)) * ((adc_T>>4) - ((int32_t)c->dig_T1))) >> 12) * ((int32_t)c->dig_T3)) >> 14;
+		t_fine = var1 + var2;
+
+		var1 = ((int64_t)t_fine) - 128000;
+		var2 = var1 * var1 * (int64_t)c->dig_P6;
+		var2 = var2 + ((var1*(int64_t)c->dig_P5)<<17);
+		var2 = var2 + (((int64_t)c->dig_P4)<<35);
+		var1 = ((var1 * var1 * (int64_t)c->dig_P3)>>8) + ((var1 * (int64_t)c->dig_P2)<<12);
+		var1 = (((((int64_t)1)<<47)+var1))*((int64_t)c->dig_P1)>>33;
+		if(var1 == 0)
+			return 0;
+
+		p = 1048576 - s[i].adc_P;
+		p = (((p<<31) - var2)*3125) / var1;
+		var1 = (((int64_t)c->dig_P9) * (p>>13) * (p>>13)) >> 25;
+		var2 = (((int64_t)c->dig_P8) * p) >> 19;
+
+		sum += ((p + var1 + var2) >> 8) + (((int64_t)c->dig_P7)<<4);
+	}
+
+	return sum/(means*26);
+}
+
+/* Input ---------------------------------------------------------------- */
+
+static void set_calib16(uint8_t reg, int32_t val)
+{
+	regs[reg] = val;
+	regs[reg+1] = val >> 8;
+}
+
+/* Calibration example of the datasheet (BMP280 DS 3.12) */
+static void default_calib(void)
+{
+	set_calib16(0x88, 27504);
+	set_calib16(0x8A, 26435);
+	set_calib16(0x8C, -1000);
+	set_calib16(0x8E, 36477);
+	set_calib16(0x90, -10685);
+	set_calib16(0x92, 3024);
+	set_calib16(0x94, 2855);
+	set_calib16(0x96, 140);
+	set_calib16(0x98, -7);
+	set_calib16(0x9A, 15500);
+	set_calib16(0x9C, -14600);
+	set_calib16(0x9E, 6000);
+	regs[0xA1] = 75;
+	set_calib16(0xE1, 362);
+}
+
+/* Ascent from ground to about 30 km while cooling down, with noise */
+static void synthetic_ascent(void)
+{
+	nsamples = 20000;
+	for(uint32_t i=0; i<nsamples; i++) {
+		samples[i].adc_P = 415148 + (int64_t)(1000000 - 415148 - 20000) * i / nsamples + (int32_t)(rnd() % 81) - 40;
+		samples[i].adc_T = 519888 - (int64_t)100000 * i / nsamples + (int32_t)(rnd() % 41) - 20;
+		samples[i].adc_H = 30000;
+	}
+}
+
+static int load_recording(const char *filename)
+{
+	char line[256];
+	FILE *f = fopen(filename, "r");
+
+	if(!f) {
+		perror(filename);
+		return -1;
+	}
+
+	while(fgets(line, sizeof(line), f) && nsamples < MAX_SAMPLES)
+	{
+		if(line[0] == '#')
+			continue;
+
+		if(!strncmp(line, "calib", 5)) {
+			char *p = line + 5;
+			for(int i=0; i<33; i++) {
+				uint8_t reg = i < 26 ? 0x88 + i : 0xE1 + i - 26;
+				regs[reg] = strtoul(p, &p, 16);
+			}
+			continue;
+		}
+
+		sample_t *s = &samples[nsamples];
+		if(sscanf(line, "%d %d %d", &s->adc_P, &s->adc_T, &s->adc_H) == 3)
+			nsamples++;
+	}
+
+	fclose(f);
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	bme280_t bme;
+	uint32_t readings = 0, worst = 0;
+	uint64_t total = 0;
+
+	default_calib();
+	regs[BME280_REGISTER_CHIPID] = 0x60;
+
+	if(argc > 1) {
+		if(load_recording(argv[1]))
+			return 1;
+	} else {
+		synthetic_ascent();
+	}
+
+	if(nsamples < BME280_MEANS + 1) {
+		fprintf(stderr, "Recording too short\n");
+		return 1;
+	}
+
+	cur = 0;
+	load_data_regs();
+	BME280_Open(&bme, BME280_ADDRESS_INT);
+	if(!BME280_Ready(&bme)) {
+		fprintf(stderr, "Sensor initialization failed\n");
+		return 1;
+	}
+
+	uint32_t init_transactions = transactions;
+	transactions = 0;
+
+	while(cur + BME280_MEANS <= nsamples)
+	{
+		uint32_t start = cur;
+		BME280_Ready(&bme); // No I2C traffic while initialized
+		uint32_t p = BME280_getPressure(&bme, BME280_MEANS);
+		uint32_t ref = ref_pressure(&bme.calib, &samples[start], BME280_MEANS);
+		uint32_t diff = p > ref ? p - ref : ref - p;
+
+		if(diff > worst) {
+			worst = diff;
+			if(diff > TOLERANCE)
+				printf("Measurement %u: %u.%u Pa, previous path %u.%u Pa\n", start, p/10, p%10, ref/10, ref%10);
+		}
+		total += diff;
+		readings++;
+
+		chThdSleepMilliseconds(BME280_MEAS_TIME); // Next reading starts with a new measurement
+	}
+
+	printf("%u measurements, %u readings of %u measurements\n", nsamples, readings, BME280_MEANS);
+	printf("Deviation from previous path: max %u.%u Pa, mean %.2f Pa\n", worst/10, worst%10, total / 10.0 / readings);
+	printf("I2C transactions: init %u, %.1f per reading (previous path %u)\n",
+		init_transactions, (double)transactions / readings, 2*256);
+
+	if(worst > TOLERANCE) {
+		printf("FAILED (tolerance %u.%u Pa)\n", TOLERANCE/10, TOLERANCE%10);
+		return 1;
+	}
+
+	// Sensor stops measuring, every failed probe doubles the backoff once
+	skipping = true;
+	load_data_regs();
+	BME280_getPressure(&bme, BME280_MEANS); // Marks the sensor lost
+	uint16_t expected = BME280_RETRY_MIN;
+	for(uint32_t i=0; i<3; i++) {
+		if(bme.ready || bme.backoff != expected) {
+			printf("FAILED (backoff %u s after %u failed probes, expected %u s)\n", bme.backoff, i, expected);
+			return 1;
+		}
+		now += S2ST(bme.backoff);
+		BME280_Ready(&bme);
+		expected *= 2;
+	}
+	skipping = false;
+	now += S2ST(bme.backoff);
+	if(!BME280_Ready(&bme) || bme.backoff) {
+		printf("FAILED (sensor not recovered)\n");
+		return 1;
+	}
+	printf("Backoff after 1..3 failed probes: %u, %u, %u s\n", BME280_RETRY_MIN, BME280_RETRY_MIN*2, BME280_RETRY_MIN*4);
+	printf("OK\n");
+	return 0;
+}
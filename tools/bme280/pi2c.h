@@ -0,0 +1,13 @@
+/* Host replacement for the I2C wrapper. Register reads are served from the */
+/* register file of a simulated BME280 which replays recorded raw data.    */
+
+#ifndef __I2C_H__
+#define __I2C_H__
+
+#include "ch.h"
+
+bool I2C_write8(uint8_t address, uint8_t reg, uint8_t value);
+bool I2C_read8(uint8_t address, uint8_t reg, uint8_t *val);
+bool I2C_readN(uint8_t address, uint8_t reg, uint8_t *rxbuf, uint32_t length);
+
+#endif
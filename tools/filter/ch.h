@@ -0,0 +1,9 @@
+/* Host replacement for ChibiOS, so the time conversion can be built on a PC */
+
+#ifndef __CH_H__
+#define __CH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#endif
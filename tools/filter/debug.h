@@ -0,0 +1,9 @@
+/* Host replacement for the debug output */
+
+#ifndef __DEBUG_H__
+#define __DEBUG_H__
+
+#define TRACE_INFO(format, args...)
+#define PRINT_TIME(thd)
+
+#endif
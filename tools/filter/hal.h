@@ -0,0 +1,29 @@
+/* Host replacement for the ChibiOS HAL (RTC only, never called by the check) */
+
+#ifndef __HAL_H__
+#define __HAL_H__
+
+#include <string.h>
+
+typedef struct {
+	uint32_t year;
+	uint32_t month;
+	uint32_t day;
+	uint32_t millisecond;
+} RTCDateTime;
+
+static int RTCD1 __attribute__((unused));
+
+static inline void rtcGetTime(int *rtcp, RTCDateTime *timespec)
+{
+	(void)rtcp;
+	memset(timespec, 0, sizeof(RTCDateTime));
+}
+
+static inline void rtcSetTime(int *rtcp, const RTCDateTime *timespec)
+{
+	(void)rtcp;
+	(void)timespec;
+}
+
+#endif
@@ -0,0 +1,169 @@
+/* Position filter check                                                  */
+/*=======================================================================*/
+/* Feeds a simulated flight through math/filter.c the way the tracking    */
+/* module does: one track point per TRACK_CYCLE_TIME, time taken from the */
+/* track point date by date2UnixSeconds, some GPS fixes missed. The       */
+/* extrapolated positions are compared with the true flight and with the  */
+/* frozen last fix (the behaviour without filter). Then a GPS outage     */
+/* with barometric altitude only: the horizontal extrapolation has to     */
+/* stop FILTER_MAX_PREDICT after the last fix, the altitude follows the   */
+/* barometer.                                                             */
+/*                                                                       */
+/* Usage: filter                                                         */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ptime.h"
+#include "filter.h"
+
+#define CYCLE_TIME		120				/* Tracking cycle in s, as TRACK_CYCLE_TIME */
+#define CYCLES			120
+#define MISS_EVERY		4				/* Every n-th fix is missed */
+#define SETTLE			20				/* Cycles until the filter is expected to be settled */
+#define MAX_HERR		50				/* Max. horizontal error in m of an extrapolated position */
+#define MAX_VERR		20				/* Max. vertical error in m of an extrapolated position */
+#define OUTAGE_CYCLES	60				/* Cycles without GPS fix at the end (2h) */
+#define OUTAGE_DRIFT	11000			/* Max. distance in m from the last fix (10m/s for FILTER_MAX_PREDICT, with margin) */
+
+static uint32_t prng = 0x1D872B41;
+
+/* Noise in -range..range */
+static int32_t noise(int32_t range)
+{
+	prng ^= prng << 13;
+	prng ^= prng >> 17;
+	prng ^= prng << 5;
+	return (int32_t)(prng % (2*range+1)) - range;
+}
+
+/* Advances the date of the track point by one cycle (within the day) */
+static void nextCycle(ptime_t *date)
+{
+	date->second += CYCLE_TIME;
+	date->minute += date->second / 60;
+	date->second %= 60;
+	date->hour += date->minute / 60;
+	date->minute %= 60;
+}
+
+static int32_t lonDiff(int64_t a, int64_t b)
+{
+	int64_t d = a - b;
+	while(d > 1800000000LL)
+		d -= 3600000000LL;
+	while(d < -1800000000LL)
+		d += 3600000000LL;
+	return d;
+}
+
+int main(void)
+{
+	posFilter_t f;
+	filterInit(&f);
+
+	// Balloon drifting 5m/s north, 10m/s east across the date line, climbing 5m/s
+	int64_t lat = 480000000, lon = 1790000000, alt = 1000;	// deg*10^7, m
+	const int32_t vlat = 450, vlon = 900, valt = 5;			// per s
+	ptime_t date = {2017, 6, 1, 10, 0, 0, 0};				// Flight stays within the day
+
+	int32_t fix_lat = 0, fix_lon = 0, fix_alt = 0;
+	uint32_t herr_max = 0, verr_max = 0, frozen_max = 0;
+	uint32_t predictions = 0;
+
+	for(uint32_t c=0; c<CYCLES; c++)
+	{
+		uint32_t now = date2UnixSeconds(date); // Time source of the tracking module
+		nextCycle(&date);
+
+		lat += vlat * CYCLE_TIME;
+		lon = lon + vlon * CYCLE_TIME > 1800000000LL ? lon + vlon * CYCLE_TIME - 3600000000LL : lon + vlon * CYCLE_TIME;
+		alt += valt * CYCLE_TIME;
+		int32_t baro = alt * 100 + 5000 + noise(50); // Barometric altitude in cm with offset
+
+		if(c < SETTLE/2 || c % MISS_EVERY != MISS_EVERY-1) { // GPS lock
+			fix_lat = lat + noise(100);
+			fix_lon = lon + noise(100);
+			fix_alt = alt + noise(2);
+			filterGPS(&f, now, fix_lat, fix_lon, fix_alt, true, baro);
+			continue;
+		}
+
+		// GPS fix missed
+		int32_t plat, plon, palt;
+		filterBaro(&f, now, baro);
+		if(!filterPredict(&f, now, &plat, &plon, &palt)) {
+			printf("Cycle %u: no prediction\n", c);
+			return 1;
+		}
+
+		uint32_t herr = (abs((int32_t)(plat - lat)) > abs(lonDiff(plon, lon)) ? abs((int32_t)(plat - lat)) : abs(lonDiff(plon, lon))) * 111 / 10000;
+		uint32_t verr = abs((int32_t)(palt - alt));
+		uint32_t frozen = abs(lonDiff(fix_lon, lon)) * 111 / 10000;
+		printf("Cycle %3u: extrapolated %3u s, error %4u m horizontal %3u m vertical (frozen fix %5u m)\n",
+			c, now - f.fix_time, herr, verr, frozen);
+
+		if(c >= SETTLE) {
+			if(herr > herr_max)
+				herr_max = herr;
+			if(verr > verr_max)
+				verr_max = verr;
+			if(frozen > frozen_max)
+				frozen_max = frozen;
+			predictions++;
+		}
+	}
+
+	printf("%u extrapolations: max error %u m horizontal, %u m vertical (frozen fix %u m)\n",
+		predictions, herr_max, verr_max, frozen_max);
+
+	if(herr_max > MAX_HERR || verr_max > MAX_VERR || herr_max >= frozen_max) {
+		printf("FAILED (tolerance %u m horizontal, %u m vertical)\n", MAX_HERR, MAX_VERR);
+		return 1;
+	}
+
+	// GPS outage, barometric altitude only
+	int32_t last_lat = 0, last_lon = 0;
+	uint32_t drift_max = 0, outage_verr_max = 0, moved = 0;
+	for(uint32_t c=0; c<OUTAGE_CYCLES; c++)
+	{
+		uint32_t now = date2UnixSeconds(date);
+		nextCycle(&date);
+
+		lat += vlat * CYCLE_TIME;
+		lon = lon + vlon * CYCLE_TIME > 1800000000LL ? lon + vlon * CYCLE_TIME - 3600000000LL : lon + vlon * CYCLE_TIME;
+		alt += valt * CYCLE_TIME;
+		int32_t baro = alt * 100 + 5000 + noise(50);
+
+		int32_t plat, plon, palt;
+		filterBaro(&f, now, baro);
+		filterPredict(&f, now, &plat, &plon, &palt);
+
+		uint32_t dlat = abs((int32_t)(plat - fix_lat));
+		uint32_t dlon = abs(lonDiff(plon, fix_lon));
+		uint32_t drift = (dlat > dlon ? dlat : dlon) * 111 / 10000;
+		uint32_t verr = abs((int32_t)(palt - alt));
+		if(drift > drift_max)
+			drift_max = drift;
+		if(verr > outage_verr_max)
+			outage_verr_max = verr;
+		if(now - f.fix_time > FILTER_MAX_PREDICT + CYCLE_TIME && (plat != last_lat || plon != last_lon))
+			moved++; // Still extrapolated after the limit
+		last_lat = plat;
+		last_lon = plon;
+
+		if(c % 10 == 9)
+			printf("Outage %5u s: %5u m from last fix, %3u m vertical error\n", now - f.fix_time, drift, verr);
+	}
+
+	printf("Outage of %u s: max %u m from last fix, %u m vertical error\n",
+		OUTAGE_CYCLES * CYCLE_TIME, drift_max, outage_verr_max);
+
+	if(drift_max > OUTAGE_DRIFT || moved || outage_verr_max > MAX_VERR) {
+		printf("FAILED (outage: tolerance %u m from last fix, %u m vertical, %u extrapolations beyond %u s)\n",
+			OUTAGE_DRIFT, MAX_VERR, moved, FILTER_MAX_PREDICT);
+		return 1;
+	}
+
+	printf("OK\n");
+	return 0;
+}
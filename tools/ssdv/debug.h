@@ -0,0 +1,27 @@
+
+/* Host replacement for the firmware's debug.h, so the SSDV sources can be */
+/* built on a PC without ChibiOS. Trace output goes to stderr and is only  */
+/* shown when the tool runs in verbose mode.                               */
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <stdio.h>
+
+extern int ssdv_verbose;
+
+#define TRACE_BASE(format, type, args...) { \
+	if(ssdv_verbose) { \
+		fprintf(stderr, "[%s] ", type); \
+		fprintf(stderr, (format), ##args); \
+		fprintf(stderr, "\n"); \
+	} \
+}
+
+#define TRACE_DEBUG(format, args...) TRACE_BASE(format, "DEBUG", ##args)
+#define TRACE_INFO(format, args...)  TRACE_BASE(format, "     ", ##args)
+#define TRACE_WARN(format, args...)  TRACE_BASE(format, "WARN ", ##args)
+#define TRACE_ERROR(format, args...) TRACE_BASE(format, "ERROR", ##args)
+
+#endif
+
@@ -0,0 +1,688 @@
+
+/* SSDV host tool                                                        */
+/*=======================================================================*/
+/* Builds the tracker's SSDV encoder/decoder on a PC. Used to encode     */
+/* test images the same way the tracker does, to decode recorded packet  */
+/* streams of one or several trackers and to benchmark the codec.        */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <time.h>
+#include "ssdv.h"
+#include "rs8.h"
+#include "crc32.h"
+
+#define DEC_SLOTS    (8)         /* Images decoded at the same time        */
+#define DEC_JPEG_LEN (1024*1024) /* Output buffer of each decoder slot     */
+
+int ssdv_verbose = 0;
+
+typedef struct {
+	ssdv_t   dec;
+	uint8_t  *jpeg;
+	uint8_t  used;
+	uint32_t callsign;
+	uint8_t  image_id;
+	uint16_t next_id;   /* Next packet ID expected                */
+	uint16_t lost;      /* Packets missing in the image so far    */
+	uint8_t  eoi;       /* Last packet of the image was received  */
+	uint32_t last_use;
+} dec_slot_t;
+
+typedef struct {
+	uint32_t packets;   /* Valid packets                          */
+	uint32_t corrected; /* Valid packets with corrected bytes     */
+	uint32_t images;    /* Images reconstructed                   */
+	uint32_t complete;  /* ... of which had no packet missing     */
+	uint32_t skipped;   /* Bytes not part of a valid packet       */
+} dec_stats_t;
+
+static uint32_t prng = 0x2F6E2B1;
+
+static void exit_usage(void)
+{
+	fprintf(stderr,
+		"Usage: ssdv [-e|-d|-s|-b|-B] [-t <type>] [-c <callsign>] [-i <id>] [-v] [<in file>] [<out file>]\n"
+		"\n"
+		"  -e Encode JPEG to SSDV packets.\n"
+		"  -d Decode a SSDV packet stream to JPEG. The stream may hold several\n"
+		"     images of several callsigns. Each image is written to\n"
+		"     <out file>_<callsign>_<id>.jpg (default ssdv_<callsign>_<id>.jpg).\n"
+		"  -s Print the image statistics the encoder gathers from a JPEG\n"
+		"     (used on board to select the best of several frames).\n"
+		"  -b Benchmark the Reed-Solomon encoder and CRC32 on the packets of a JPEG.\n"
+		"  -B Benchmark the decoder on a SSDV packet stream.\n"
+		"\n"
+		"  -t Packet type: 0 = normal (FEC, 2FSK), 1 = no-FEC (APRS). Default 0.\n"
+		"  -c Callsign (up to 6 characters). Default PECAN.\n"
+		"  -i Image ID (0-255). Default 0.\n"
+		"  -n Benchmark rounds. Default 200.\n"
+		"  -E Byte errors injected per packet (-B). Default 8.\n"
+		"  -X Byte erasures injected per packet (-B, Reed-Solomon only). Default 0.\n"
+		"  -L Packet loss in percent (-B). Default 0.\n"
+		"  -v Print trace output of the codec.\n"
+		"\n");
+	exit(-1);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t rnd(void)
+{
+	prng ^= prng << 13;
+	prng ^= prng >> 17;
+	prng ^= prng << 5;
+	return(prng);
+}
+
+/* Corrupts n distinct bytes of data[0..len-1], the positions are written
+ * to pos[] if not NULL */
+static void corrupt(uint8_t *data, int len, int n, int *pos, uint8_t *hit)
+{
+	int i, p;
+
+	memset(hit, 0, len);
+	for(i = 0; i < n; i++)
+	{
+		do p = rnd() % len; while(hit[p]);
+		hit[p] = 1;
+		data[p] ^= 1 + rnd() % 255;
+		if(pos) pos[i] = p;
+	}
+}
+
+/* Reads a whole file into memory */
+static uint8_t *read_file(FILE *f, size_t *length)
+{
+	uint8_t *buf = NULL;
+	size_t len = 0, size = 0, r;
+
+	do
+	{
+		if(len == size)
+		{
+			size = size ? size * 2 : 65536;
+			buf = realloc(buf, size);
+			if(!buf) return(NULL);
+		}
+		r = fread(buf + len, 1, size - len, f);
+		len += r;
+	}
+	while(r > 0);
+
+	*length = len;
+	return(buf);
+}
+
+/* Encodes a JPEG image into SSDV packets, the way moduleIMG does it on
+ * the tracker. Returns the number of packets written to *pkts. */
+static int encode_image(uint8_t *jpeg, size_t jpeg_len, uint8_t type, char *callsign, uint8_t image_id, uint8_t **pkts, ssdv_stats_t *stats)
+{
+	ssdv_t ssdv;
+	uint8_t pkt[SSDV_PKT_SIZE];
+	size_t bi = 0;
+	int n = 0, size = 0;
+	char c;
+
+	*pkts = NULL;
+
+	ssdv_enc_init(&ssdv, type, callsign, image_id);
+	ssdv_enc_set_buffer(&ssdv, pkt);
+	if(stats) ssdv_enc_set_stats(&ssdv, stats);
+
+	while(1)
+	{
+		while((c = ssdv_enc_get_packet(&ssdv)) == SSDV_FEED_ME)
+		{
+			size_t r = jpeg_len - bi < 128 ? jpeg_len - bi : 128;
+			if(r == 0)
+			{
+				fprintf(stderr, "Premature end of file\n");
+				return(-1);
+			}
+			ssdv_enc_feed(&ssdv, &jpeg[bi], r);
+			bi += r;
+		}
+
+		if(c == SSDV_EOI) break;
+		else if(c != SSDV_OK)
+		{
+			fprintf(stderr, "ssdv_enc_get_packet() failed: %i\n", c);
+			return(-1);
+		}
+
+		if(n == size)
+		{
+			size = size ? size * 2 : 64;
+			*pkts = realloc(*pkts, size * SSDV_PKT_SIZE);
+			if(!*pkts) return(-1);
+		}
+		memcpy(*pkts + n * SSDV_PKT_SIZE, pkt, SSDV_PKT_SIZE);
+		n++;
+	}
+
+	return(n);
+}
+
+static void print_stats(const ssdv_stats_t *stats)
+{
+	double mean = 0, var = 0;
+
+	if(stats->blocks)
+	{
+		mean = (double) stats->dc_sum / stats->blocks;
+		var = (double) stats->dc_sqsum / stats->blocks - mean * mean;
+	}
+
+	/* The DC value of a block is 8 * (average - 128) */
+	printf("Entropy coded   %u bytes\n", stats->bits / 8);
+	printf("Luma blocks     %u\n", stats->blocks);
+	printf("Luma mean       %.1f\n", 128 + mean / 8);
+	printf("Luma deviation  %.1f\n", sqrt(var > 0 ? var : 0) / 8);
+	printf("MCU rows        %u (%u flat)\n", stats->rows, stats->flat_rows);
+}
+
+/* Checks crc32() against crc32_ref() on every length and alignment up to
+ * a packet, then times both on the CRC'd part of the packets */
+static int benchmark_crc(uint8_t *pkts, int n, int rounds)
+{
+	uint8_t buf[SSDV_PKT_SIZE + 8];
+	int i, r, len, off, mismatch = 0;
+	volatile uint32_t x = 0;
+	double t, t_ref, t_fast;
+
+	for(i = 0; i < (int) sizeof(buf); i++) buf[i] = rnd();
+	for(off = 0; off < 8; off++)
+		for(len = 0; len <= SSDV_PKT_SIZE; len++)
+			if(crc32(&buf[off], len) != crc32_ref(&buf[off], len)) mismatch++;
+
+	/* Same span as the encoder: the header and payload of a packet */
+	len = SSDV_PKT_SIZE - SSDV_PKT_SIZE_CRC - SSDV_PKT_SIZE_RSCODES - 1;
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			x = crc32_ref(&pkts[i * SSDV_PKT_SIZE + 1], len);
+	t_ref = now() - t;
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			x = crc32(&pkts[i * SSDV_PKT_SIZE + 1], len);
+	t_fast = now() - t;
+
+	printf("crc32_ref():         %.0f packets/s\n", n * rounds / t_ref);
+	printf("crc32():             %.0f packets/s (x%.1f)\n", n * rounds / t_fast, t_ref / t_fast);
+	printf("CRC mismatches:      %i\n", mismatch);
+	(void) x;
+
+	return(mismatch ? -1 : 0);
+}
+
+static int benchmark_encoder(uint8_t *jpeg, size_t jpeg_len, char *callsign, int rounds)
+{
+	uint8_t *pkts, *p, parity[SSDV_PKT_SIZE_RSCODES];
+	int i, r, n, mismatch = 0;
+	double t, t_ref, t_fast, t_enc;
+
+	/* Full packet encoder, including CRC and RS codes */
+	t = now();
+	for(r = 0; r < rounds; r++)
+	{
+		n = encode_image(jpeg, jpeg_len, SSDV_TYPE_NORMAL, callsign, 0, &pkts, NULL);
+		if(n < 0) return(-1);
+		if(r < rounds - 1) free(pkts);
+	}
+	t_enc = now() - t;
+
+	/* The packets now hold the parity calculated by encode_rs_8_fast(),
+	 * check the reference encoder produces the same bytes */
+	for(i = 0; i < n; i++)
+	{
+		p = pkts + i * SSDV_PKT_SIZE;
+		encode_rs_8(&p[1], parity, 0);
+		if(memcmp(parity, &p[SSDV_PKT_SIZE - SSDV_PKT_SIZE_RSCODES], SSDV_PKT_SIZE_RSCODES)) mismatch++;
+	}
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			encode_rs_8(&pkts[i * SSDV_PKT_SIZE + 1], parity, 0);
+	t_ref = now() - t;
+
+	t = now();
+	for(r = 0; r < rounds; r++)
+		for(i = 0; i < n; i++)
+			encode_rs_8_fast(&pkts[i * SSDV_PKT_SIZE + 1], parity, 0);
+	t_fast = now() - t;
+
+	printf("Packets per image:   %i (2FSK, normal mode with FEC)\n", n);
+	printf("Packet encoder:      %.0f packets/s\n", n * rounds / t_enc);
+	printf("encode_rs_8():       %.0f packets/s\n", n * rounds / t_ref);
+	printf("encode_rs_8_fast():  %.0f packets/s (x%.1f)\n", n * rounds / t_fast, t_ref / t_fast);
+	printf("Parity mismatches:   %i\n", mismatch);
+
+	if(benchmark_crc(pkts, n, rounds)) mismatch++;
+
+	free(pkts);
+
+	return(mismatch ? -1 : 0);
+}
+
+static void dec_flush(dec_slot_t *slot, const char *prefix, dec_stats_t *stats)
+{
+	char callsign[SSDV_MAX_CALLSIGN + 1];
+	char filename[256];
+	uint8_t *jpeg;
+	size_t length;
+	FILE *f;
+	ssdv_packet_info_t p;
+	uint8_t hdr[SSDV_PKT_SIZE] = {0};
+
+	if(!slot->used) return;
+	slot->used = 0;
+
+	ssdv_dec_get_jpeg(&slot->dec, &jpeg, &length);
+
+	stats->images++;
+	if(slot->eoi && !slot->lost) stats->complete++;
+
+	if(!prefix) return;
+
+	/* Decode the callsign the same way the packet header does */
+	hdr[2] = slot->callsign >> 24;
+	hdr[3] = slot->callsign >> 16;
+	hdr[4] = slot->callsign >> 8;
+	hdr[5] = slot->callsign;
+	ssdv_dec_header(&p, hdr);
+	strcpy(callsign, p.callsign_s);
+
+	snprintf(filename, sizeof(filename), "%s_%s_%i.jpg", prefix, callsign, slot->image_id);
+	f = fopen(filename, "wb");
+	if(!f)
+	{
+		fprintf(stderr, "Error opening '%s' for output:\n", filename);
+		perror("fopen");
+		return;
+	}
+	fwrite(jpeg, 1, length, f);
+	fclose(f);
+
+	fprintf(stderr, "%s: %s image %i, %i packets lost%s\n", filename, callsign, slot->image_id,
+		slot->lost, slot->eoi ? "" : ", no EOI");
+}
+
+/* Decodes a stream of SSDV packets. The stream is scanned for valid
+ * packets, everything between them is skipped. The packets of each
+ * callsign go to their own decoder, so the packets of several trackers
+ * may be interleaved. A new image ID of a callsign finishes its image.
+ * If prefix is NULL, images are decoded but not written. */
+static void decode_stream(uint8_t *buf, size_t len, dec_slot_t *slots, const char *prefix, dec_stats_t *stats)
+{
+	ssdv_packet_info_t p;
+	dec_slot_t *slot;
+	uint32_t tick = 0;
+	size_t i = 0;
+	int errors, j;
+
+	while(i + SSDV_PKT_SIZE <= len)
+	{
+		if(ssdv_dec_is_packet(&buf[i], &errors) != 0)
+		{
+			i++;
+			stats->skipped++;
+			continue;
+		}
+
+		stats->packets++;
+		if(errors > 0) stats->corrected++;
+
+		ssdv_dec_header(&p, &buf[i]);
+
+		/* Find the decoder of this callsign, or the least recently used */
+		slot = NULL;
+		for(j = 0; j < DEC_SLOTS; j++)
+			if(slots[j].used && slots[j].callsign == p.callsign) slot = &slots[j];
+
+		if(slot && slot->image_id != p.image_id) dec_flush(slot, prefix, stats);
+
+		if(!slot || !slot->used)
+		{
+			if(!slot)
+			{
+				slot = &slots[0];
+				for(j = 0; j < DEC_SLOTS; j++)
+				{
+					if(!slots[j].used) { slot = &slots[j]; break; }
+					if(slots[j].last_use < slot->last_use) slot = &slots[j];
+				}
+				dec_flush(slot, prefix, stats);
+			}
+
+			ssdv_dec_init(&slot->dec);
+			ssdv_dec_set_buffer(&slot->dec, slot->jpeg, DEC_JPEG_LEN);
+			slot->used = 1;
+			slot->callsign = p.callsign;
+			slot->image_id = p.image_id;
+			slot->next_id = 0;
+			slot->lost = 0;
+			slot->eoi = 0;
+		}
+		slot->last_use = tick++;
+
+		/* Duplicates and late packets cannot be merged into the image */
+		if(p.packet_id >= slot->next_id && !slot->eoi)
+		{
+			slot->lost += p.packet_id - slot->next_id;
+			slot->next_id = p.packet_id + 1;
+			if(p.eoi) slot->eoi = 1;
+
+			ssdv_dec_feed(&slot->dec, &buf[i]);
+		}
+
+		i += SSDV_PKT_SIZE;
+	}
+	stats->skipped += len - i;
+
+	for(j = 0; j < DEC_SLOTS; j++)
+		dec_flush(&slots[j], prefix, stats);
+}
+
+static dec_slot_t *dec_alloc(void)
+{
+	dec_slot_t *slots;
+	int j;
+
+	slots = calloc(DEC_SLOTS, sizeof(dec_slot_t));
+	if(!slots) return(NULL);
+	for(j = 0; j < DEC_SLOTS; j++)
+	{
+		slots[j].jpeg = malloc(DEC_JPEG_LEN);
+		if(!slots[j].jpeg) return(NULL);
+	}
+	return(slots);
+}
+
+static void dec_free(dec_slot_t *slots)
+{
+	int j;
+
+	for(j = 0; j < DEC_SLOTS; j++)
+		free(slots[j].jpeg);
+	free(slots);
+}
+
+static int benchmark_decoder(uint8_t *stream, size_t len, int rounds, int errors, int erasures, int loss)
+{
+	uint8_t *in, *work, *out, hit[SSDV_PKT_SIZE];
+	int *eras, *eras_work;
+	int n, i, r, k, ret_ref, ret_fast, mismatch = 0, failed = 0;
+	double t, t_ref, t_fast, t_dec = 0;
+	size_t olen;
+	dec_slot_t *slots;
+	dec_stats_t stats;
+	uint32_t packets_in = 0;
+
+	n = len / SSDV_PKT_SIZE;
+	if(n == 0 || errors + erasures > 255)
+	{
+		fprintf(stderr, "Nothing to benchmark\n");
+		return(-1);
+	}
+
+	/* Reed-Solomon: both decoders get the same corrupted codewords. A
+	 * packet is the sync byte followed by the 255 byte codeword. */
+	in = malloc((size_t) n * rounds * SSDV_PKT_SIZE);
+	eras = malloc((size_t) n * rounds * 32 * sizeof(int));
+	work = malloc(SSDV_PKT_SIZE * 2);
+	eras_work = malloc(32 * 2 * sizeof(int));
+	if(!in || !eras || !work || !eras_work)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return(-1);
+	}
+
+	for(k = 0; k < n * rounds; k++)
+	{
+		uint8_t *pkt = &in[k * SSDV_PKT_SIZE];
+		int pos[SSDV_PKT_SIZE];
+
+		memcpy(pkt, &stream[(k % n) * SSDV_PKT_SIZE], SSDV_PKT_SIZE);
+		pkt[1] = 0x66 + SSDV_TYPE_NORMAL;
+		corrupt(&pkt[1], SSDV_PKT_SIZE - 1, errors + erasures, pos, hit);
+
+		/* The first corrupted positions are passed as erasures */
+		for(i = 0; i < erasures && i < 32; i++) eras[k * 32 + i] = pos[i];
+	}
+	if(erasures > 32) erasures = 32;
+
+	t = now();
+	for(k = 0; k < n * rounds; k++)
+	{
+		memcpy(work, &in[k * SSDV_PKT_SIZE + 1], SSDV_PKT_SIZE - 1);
+		memcpy(eras_work, &eras[k * 32], erasures * sizeof(int));
+		decode_rs_8(work, eras_work, erasures, 0);
+	}
+	t_ref = now() - t;
+
+	t = now();
+	for(k = 0; k < n * rounds; k++)
+	{
+		memcpy(work, &in[k * SSDV_PKT_SIZE + 1], SSDV_PKT_SIZE - 1);
+		memcpy(eras_work, &eras[k * 32], erasures * sizeof(int));
+		decode_rs_8_fast(work, eras_work, erasures, 0);
+	}
+	t_fast = now() - t;
+
+	/* Check both decoders return and correct the same */
+	for(k = 0; k < n * rounds; k++)
+	{
+		uint8_t *w2 = work + SSDV_PKT_SIZE;
+		int *e2 = eras_work + 32;
+
+		memcpy(work, &in[k * SSDV_PKT_SIZE + 1], SSDV_PKT_SIZE - 1);
+		memcpy(w2, work, SSDV_PKT_SIZE - 1);
+		memcpy(eras_work, &eras[k * 32], erasures * sizeof(int));
+		memcpy(e2, eras_work, erasures * sizeof(int));
+
+		ret_ref = decode_rs_8(work, eras_work, erasures, 0);
+		ret_fast = decode_rs_8_fast(w2, e2, erasures, 0);
+
+		if(ret_ref != ret_fast || memcmp(work, w2, SSDV_PKT_SIZE - 1)) mismatch++;
+		if(ret_fast < 0) failed++;
+	}
+
+	printf("Packets:             %i x %i rounds, %i errors + %i erasures each\n", n, rounds, errors, erasures);
+	printf("decode_rs_8():       %.0f packets/s\n", n * rounds / t_ref);
+	printf("decode_rs_8_fast():  %.0f packets/s (x%.1f)\n", n * rounds / t_fast, t_ref / t_fast);
+	printf("Uncorrectable:       %i\n", failed);
+	printf("Decoder mismatches:  %i\n", mismatch);
+
+	free(in);
+	free(eras);
+	free(work);
+	free(eras_work);
+
+	/* Full decoder: scan the stream, check the packets and decode the
+	 * images. Erasures are not known at this level, only errors and
+	 * lost packets are injected. */
+	out = malloc(len);
+	slots = dec_alloc();
+	if(!out || !slots)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return(-1);
+	}
+	memset(&stats, 0, sizeof(stats));
+
+	for(r = 0; r < rounds; r++)
+	{
+		olen = 0;
+		for(k = 0; k < n; k++)
+		{
+			if(loss && (int) (rnd() % 100) < loss) continue;
+
+			memcpy(&out[olen], &stream[k * SSDV_PKT_SIZE], SSDV_PKT_SIZE);
+			if(stream[k * SSDV_PKT_SIZE + 1] == 0x66 + SSDV_TYPE_NORMAL)
+				corrupt(&out[olen + 2], SSDV_PKT_SIZE - 2, errors, NULL, hit);
+			olen += SSDV_PKT_SIZE;
+		}
+		packets_in += olen / SSDV_PKT_SIZE;
+
+		t = now();
+		decode_stream(out, olen, slots, NULL, &stats);
+		t_dec += now() - t;
+	}
+
+	printf("Stream decoder:      %.0f packets/s, %i lost in transmission\n", packets_in / t_dec, n * rounds - packets_in);
+	printf("Packets valid:       %u (%u corrected)\n", stats.packets, stats.corrected);
+	printf("Images:              %u reconstructed, %u complete\n", stats.images, stats.complete);
+
+	free(out);
+	dec_free(slots);
+
+	return(mismatch ? -1 : 0);
+}
+
+int main(int argc, char *argv[])
+{
+	int c, i, n;
+	FILE *fin = stdin;
+	FILE *fout = stdout;
+	char encode = -1;
+	char type = SSDV_TYPE_NORMAL;
+	char callsign[SSDV_MAX_CALLSIGN + 1] = "PECAN";
+	uint8_t image_id = 0;
+	int rounds = 200;
+	int errors = 8, erasures = 0, loss = 0;
+	char *prefix = "ssdv";
+	uint8_t *jpeg, *pkts;
+	size_t jpeg_len;
+	dec_slot_t *slots;
+	dec_stats_t stats;
+	ssdv_stats_t istats;
+
+	opterr = 0;
+	while((c = getopt(argc, argv, "edsbBt:c:i:n:E:X:L:v")) != -1)
+	{
+		switch(c)
+		{
+		case 'e': encode = 1; break;
+		case 'd': encode = 0; break;
+		case 'b': encode = 2; break;
+		case 'B': encode = 3; break;
+		case 's': encode = 4; break;
+		case 't': type = atoi(optarg); break;
+		case 'c':
+			strncpy(callsign, optarg, SSDV_MAX_CALLSIGN);
+			callsign[SSDV_MAX_CALLSIGN] = '\0';
+			break;
+		case 'i': image_id = atoi(optarg); break;
+		case 'n': rounds = atoi(optarg); break;
+		case 'E': errors = atoi(optarg); break;
+		case 'X': erasures = atoi(optarg); break;
+		case 'L': loss = atoi(optarg); break;
+		case 'v': ssdv_verbose = 1; break;
+		case '?': exit_usage();
+		}
+	}
+
+	c = argc - optind;
+	if(c > 2 || encode == -1 || rounds < 1) exit_usage();
+	if(errors < 0 || erasures < 0 || loss < 0 || loss > 100) exit_usage();
+
+	for(i = optind; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "-")) continue;
+
+		if(i == optind)
+		{
+			fin = fopen(argv[i], "rb");
+			if(!fin)
+			{
+				fprintf(stderr, "Error opening '%s' for input:\n", argv[i]);
+				perror("fopen");
+				return(-1);
+			}
+		}
+		else if(encode == 0)
+		{
+			prefix = argv[i];
+		}
+		else
+		{
+			fout = fopen(argv[i], "wb");
+			if(!fout)
+			{
+				fprintf(stderr, "Error opening '%s' for output:\n", argv[i]);
+				perror("fopen");
+				return(-1);
+			}
+		}
+	}
+
+	jpeg = read_file(fin, &jpeg_len);
+	if(!jpeg)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return(-1);
+	}
+
+	switch(encode)
+	{
+	case 0: /* Decode */
+		slots = dec_alloc();
+		if(!slots)
+		{
+			fprintf(stderr, "Out of memory\n");
+			return(-1);
+		}
+		memset(&stats, 0, sizeof(stats));
+		decode_stream(jpeg, jpeg_len, slots, prefix, &stats);
+		fprintf(stderr, "Read %u packets (%u corrected), skipped %u bytes, %u images\n",
+			stats.packets, stats.corrected, stats.skipped, stats.images);
+		dec_free(slots);
+		break;
+
+	case 1: /* Encode */
+		n = encode_image(jpeg, jpeg_len, type, callsign, image_id, &pkts, NULL);
+		if(n < 0) return(-1);
+		fwrite(pkts, SSDV_PKT_SIZE, n, fout);
+		fprintf(stderr, "Wrote %i packets\n", n);
+		free(pkts);
+		break;
+
+	case 2: /* Benchmark */
+		if(benchmark_encoder(jpeg, jpeg_len, callsign, rounds)) return(-1);
+		break;
+
+	case 3: /* Benchmark decoder */
+		if(benchmark_decoder(jpeg, jpeg_len, rounds, errors, erasures, loss)) return(-1);
+		break;
+
+	case 4: /* Statistics */
+		n = encode_image(jpeg, jpeg_len, SSDV_TYPE_NOFEC, callsign, image_id, &pkts, &istats);
+		if(n < 0) return(-1);
+		free(pkts);
+		print_stats(&istats);
+		break;
+	}
+
+	free(jpeg);
+	if(fin != stdin) fclose(fin);
+	if(fout != stdout) fclose(fout);
+
+	return(0);
+}
+
@@ -118,7 +118,9 @@ typedef enum {
 typedef struct {
 	char callsign[8];		// Callsign
 	resolution_t res;		// Camera resolution
-	uint8_t quality;		// JPEG quality
+	uint8_t quality;		// JPEG quality 1 (lowest) to 8 (highest), 0 = default (5)
+	uint8_t frames;			// Frames captured to transmit the best one (0 = 1)
+	bool thumbnail;			// Transmit a thumbnail ahead of the image
 	uint8_t *ram_buffer;	// Camera Buffer (do not set in config)
 	size_t ram_size;		// Size of buffer (do not set in config)
 	bool no_camera;			// Camera disabled